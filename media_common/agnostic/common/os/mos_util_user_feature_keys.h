@@ -89,6 +89,7 @@
 #define __MEDIA_USER_FEATURE_VALUE_VEBOX_SPLIT_RATIO                    "Vebox Split Ratio"
 #define __MEDIA_USER_FEATURE_SET_MCPY_FORCE_MODE                        "MCPY Force Mode"
 #define __MEDIA_USER_FEATURE_ENABLE_VECOPY_SMALL_RESOLUTION             "Enable VE copy small resolution"  // resolution smaller than 64x32
+#define __MEDIA_USER_FEATURE_ENABLE_MCPY_ADAPTIVE_ENGINE                "Enable MCPY Adaptive Engine"
 
 //!
 //! \brief Keys for mmc
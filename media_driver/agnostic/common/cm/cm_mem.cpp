@@ -24,29 +24,320 @@
 //! \brief     Contains CM memory function implementations 
 //!
 
+#include <atomic>
 #include "cm_mem.h"
 #include "cm_mem_c_impl.h"
 #include "cm_mem_sse2_impl.h"
+#include "cm_mem_avx2_impl.h"
+#include "cm_mem_avx512_impl.h"
 
-typedef void(*t_CmFastMemCopy)( void* dst, const   void* src, const size_t bytes );
 typedef void(*t_CmFastMemCopyWC)( void* dst,   const void* src, const size_t bytes );
 
 #define CM_FAST_MEM_COPY_CPU_INIT_C(func)       (func ## _C)
 #define CM_FAST_MEM_COPY_CPU_INIT_SSE2(func)    (func ## _SSE2)
-#define CM_FAST_MEM_COPY_CPU_INIT(func)         (is_SSE2_available ? CM_FAST_MEM_COPY_CPU_INIT_SSE2(func) : CM_FAST_MEM_COPY_CPU_INIT_C(func))
+#define CM_FAST_MEM_COPY_CPU_INIT_AVX2(func)    (func ## _AVX2)
+#define CM_FAST_MEM_COPY_CPU_INIT_AVX512(func)  (func ## _AVX512)
+#define CM_FAST_MEM_COPY_CPU_INIT(func)         (is_AVX512_available ? CM_FAST_MEM_COPY_CPU_INIT_AVX512(func) :  \
+                                                 is_AVX2_available   ? CM_FAST_MEM_COPY_CPU_INIT_AVX2(func)   :  \
+                                                 is_SSE2_available   ? CM_FAST_MEM_COPY_CPU_INIT_SSE2(func)   :  \
+                                                 CM_FAST_MEM_COPY_CPU_INIT_C(func))
+
+struct CM_FAST_MEM_COPY_CHUNK
+{
+    t_CmFastMemCopy copyFunc;
+    void            *dst;
+    const void      *src;
+    size_t          bytes;
+};
+
+static void CmFastMemCopyChunk( CM_FAST_MEM_COPY_CHUNK *chunk )
+{
+    chunk->copyFunc( chunk->dst, chunk->src, chunk->bytes );
+}
+
+/*****************************************************************************\
+Class:
+    CmFastMemCopyWorkerPool
+
+Description:
+    Worker threads kept for the life of the library, so a large copy only pays
+    two semaphore round trips per helper thread instead of a thread create and
+    join. One copy uses the pool at a time; a concurrent copy which finds the
+    pool busy is done by its calling thread alone.
+
+    Chunks live in pool owned slots and are claimed before being copied. The
+    calling thread claims every chunk no worker picked up yet, so a worker which
+    is late, or which stopped after its semaphore kept failing, never holds a
+    copy back. Run only returns once each claimed chunk is done.
+\*****************************************************************************/
+class CmFastMemCopyWorkerPool
+{
+public:
+    static CmFastMemCopyWorkerPool &Instance()
+    {
+        static CmFastMemCopyWorkerPool pool;
+        return pool;
+    }
+
+    uint32_t GetWorkerNum() const { return m_workerNum; }
+
+    // Returns false if the pool is in use or has no live worker, chunks are then left untouched
+    bool Run( const CM_FAST_MEM_COPY_CHUNK *chunks, uint32_t chunkNum )
+    {
+        if( m_busy == nullptr || m_done == nullptr || chunkNum > m_workerNum + 1 ||
+            MosUtilities::MosWaitSemaphore( m_busy, 0 ) != MOS_STATUS_SUCCESS )
+        {
+            return false;
+        }
+
+        uint32_t liveNum = 0;
+        for( uint32_t i = 1; i < chunkNum; i++ )
+        {
+            liveNum += m_workers[i - 1].alive ? 1 : 0;
+        }
+        if( liveNum == 0 )
+        {
+            MosUtilities::MosPostSemaphore( m_busy, 1 );
+            return false;
+        }
+
+        for( uint32_t i = 1; i < chunkNum; i++ )
+        {
+            Worker &worker = m_workers[i - 1];
+            worker.chunk   = chunks[i];
+            worker.state.store( CHUNK_PENDING, std::memory_order_release );
+            if( worker.alive )
+            {
+                MosUtilities::MosPostSemaphore( worker.start, 1 );
+            }
+        }
+
+        // The calling thread copies the first chunk, then any chunk not claimed yet
+        CM_FAST_MEM_COPY_CHUNK first = chunks[0];
+        CmFastMemCopyChunk( &first );
+        for( uint32_t i = 1; i < chunkNum; i++ )
+        {
+            Worker   &worker  = m_workers[i - 1];
+            uint32_t expected = CHUNK_PENDING;
+            if( worker.state.compare_exchange_strong( expected, CHUNK_CLAIMED, std::memory_order_acquire ) )
+            {
+                CmFastMemCopyChunk( &worker.chunk );
+                worker.state.store( CHUNK_DONE, std::memory_order_release );
+            }
+            else
+            {
+                // Claimed by its worker, which posts m_done once the chunk is done
+                m_donePosts++;
+            }
+        }
+
+        // The source and destination belong to the caller, never return before every chunk is done
+        for( uint32_t i = 1; i < chunkNum; i++ )
+        {
+            Worker &worker = m_workers[i - 1];
+            while( worker.state.load( std::memory_order_acquire ) != CHUNK_DONE )
+            {
+                WaitDonePost();
+            }
+            worker.state.store( CHUNK_IDLE, std::memory_order_relaxed );
+        }
+
+        // Consume the posts of the chunks done so m_done does not wake the next copy early.
+        // These posts follow the done states, so waiting on them does not block for long.
+        while( m_donePosts > 0 && WaitDonePost() )
+        {
+        }
+
+        MosUtilities::MosPostSemaphore( m_busy, 1 );
+        return true;
+    }
+
+private:
+    bool WaitDonePost()
+    {
+        if( MosUtilities::MosWaitSemaphore( m_done, INFINITE ) != MOS_STATUS_SUCCESS )
+        {
+            // Interrupted wait, the caller checks the chunk states again
+            MosUtilities::MosSleep( 0 );
+            return false;
+        }
+        m_donePosts--;
+        return true;
+    }
+
+    enum CHUNK_STATE : uint32_t
+    {
+        CHUNK_IDLE = 0,
+        CHUNK_PENDING,
+        CHUNK_CLAIMED,
+        CHUNK_DONE
+    };
+
+    struct Worker
+    {
+        CmFastMemCopyWorkerPool *pool   = nullptr;
+        MOS_THREADHANDLE        thread  = 0;
+        PMOS_SEMAPHORE          start   = nullptr;
+        CM_FAST_MEM_COPY_CHUNK  chunk   = {};
+        std::atomic<uint32_t>   state   = {CHUNK_IDLE};
+        std::atomic<bool>       alive   = {false};
+    };
+
+    // Consecutive failed waits after which a worker gives up, e.g. sem_wait returning on signals
+    static const uint32_t m_maxWaitFailures = 64;
+
+    CmFastMemCopyWorkerPool()
+    {
+        const uint32_t coreNum   = MosUtilities::MosGetLogicalCoreNumber();
+        const uint32_t workerMax = MOS_MIN( coreNum, CM_CPU_FASTCOPY_MT_MAX_THREADS ) - 1;
+
+        m_busy = MosUtilities::MosCreateSemaphore( 1, 1 );
+        m_done = MosUtilities::MosCreateSemaphore( 0, CM_CPU_FASTCOPY_MT_MAX_THREADS );
+        if( m_busy == nullptr || m_done == nullptr || coreNum == 0 )
+        {
+            return;
+        }
+
+        for( uint32_t i = 0; i < workerMax; i++ )
+        {
+            Worker &worker = m_workers[m_workerNum];
+            worker.pool    = this;
+            worker.alive   = true;
+            worker.start   = MosUtilities::MosCreateSemaphore( 0, 1 );
+            if( worker.start == nullptr )
+            {
+                worker.alive = false;
+                break;
+            }
+
+            worker.thread = MosUtilities::MosCreateThread( (void *)WorkerThread, &worker );
+            if( !worker.thread )
+            {
+                worker.alive = false;
+                MosUtilities::MosDestroySemaphore( worker.start );
+                break;
+            }
+            m_workerNum++;
+        }
+    }
+
+    ~CmFastMemCopyWorkerPool()
+    {
+        m_exit = true;
+        for( uint32_t i = 0; i < m_workerNum; i++ )
+        {
+            MosUtilities::MosPostSemaphore( m_workers[i].start, 1 );
+            MosUtilities::MosWaitThread( m_workers[i].thread );
+            MosUtilities::MosDestroySemaphore( m_workers[i].start );
+        }
+
+        if( m_busy )
+        {
+            MosUtilities::MosDestroySemaphore( m_busy );
+        }
+        if( m_done )
+        {
+            MosUtilities::MosDestroySemaphore( m_done );
+        }
+    }
+
+    static void *WorkerThread( void *threadData )
+    {
+        Worker   *worker   = (Worker *)threadData;
+        uint32_t failures = 0;
+
+        while( !worker->pool->m_exit )
+        {
+            if( MosUtilities::MosWaitSemaphore( worker->start, INFINITE ) != MOS_STATUS_SUCCESS )
+            {
+                // Chunks are claimed, so the copy in flight is finished by the calling thread
+                if( ++failures >= m_maxWaitFailures )
+                {
+                    break;
+                }
+                continue;
+            }
+            failures = 0;
+
+            uint32_t expected = CHUNK_PENDING;
+            if( !worker->pool->m_exit &&
+                worker->state.compare_exchange_strong( expected, CHUNK_CLAIMED, std::memory_order_acquire ) )
+            {
+                CmFastMemCopyChunk( &worker->chunk );
+                worker->state.store( CHUNK_DONE, std::memory_order_release );
+                MosUtilities::MosPostSemaphore( worker->pool->m_done, 1 );
+            }
+        }
+
+        worker->alive = false;
+        return nullptr;
+    }
+
+    Worker              m_workers[CM_CPU_FASTCOPY_MT_MAX_THREADS - 1];
+    uint32_t            m_workerNum = 0;
+    PMOS_SEMAPHORE      m_busy      = nullptr;  // held by the copy using the workers
+    PMOS_SEMAPHORE      m_done      = nullptr;  // posted once per chunk finished by a worker
+    uint32_t            m_donePosts = 0;        // posts of m_done not consumed yet
+    std::atomic<bool>   m_exit      = {false};
+};
+
+void CmFastMemCopyParallel( t_CmFastMemCopy copyFunc, void* dst, const void* src, const size_t bytes )
+{
+    if( bytes < CM_CPU_FASTCOPY_MT_THRESHOLD )
+    {
+        copyFunc( dst, src, bytes );
+        return;
+    }
+
+    CmFastMemCopyWorkerPool &pool = CmFastMemCopyWorkerPool::Instance();
+    const uint32_t threadNum = pool.GetWorkerNum() + 1;
+    if( threadNum <= 1 )
+    {
+        copyFunc( dst, src, bytes );
+        return;
+    }
+
+    // Split on page boundaries so no two threads write the same cache line
+    const size_t chunkBytes = MOS_ALIGN_CEIL( bytes / threadNum, CM_CPU_FASTCOPY_MT_CHUNK_ALIGNMENT );
+
+    CM_FAST_MEM_COPY_CHUNK chunks[CM_CPU_FASTCOPY_MT_MAX_THREADS];
+    uint32_t               chunkNum = 0;
+    size_t                 offset   = 0;
+
+    while( offset < bytes )
+    {
+        CM_FAST_MEM_COPY_CHUNK &chunk = chunks[chunkNum++];
+        chunk.copyFunc = copyFunc;
+        chunk.dst      = (uint8_t *)dst + offset;
+        chunk.src      = (const uint8_t *)src + offset;
+        chunk.bytes    = MOS_MIN( chunkBytes, bytes - offset );
+        offset        += chunk.bytes;
+    }
+
+    if( !pool.Run( chunks, chunkNum ) )
+    {
+        copyFunc( dst, src, bytes );
+    }
+}
 
 void CmFastMemCopy( void* dst, const void* src, const size_t bytes )
 {
-    static const bool is_SSE2_available = (GetCpuInstructionLevel() >= CPU_INSTRUCTION_LEVEL_SSE2);
+    static const CPU_INSTRUCTION_LEVEL cpuInstructionLevel = GetCpuInstructionLevel();
+    static const bool is_AVX512_available = (cpuInstructionLevel >= CPU_INSTRUCTION_LEVEL_AVX512);
+    static const bool is_AVX2_available = (cpuInstructionLevel >= CPU_INSTRUCTION_LEVEL_AVX2);
+    static const bool is_SSE2_available = (cpuInstructionLevel >= CPU_INSTRUCTION_LEVEL_SSE2);
     static const t_CmFastMemCopy CmFastMemCopy_impl = CM_FAST_MEM_COPY_CPU_INIT(CmFastMemCopy);
 
-    CmFastMemCopy_impl(dst, src, bytes);
+    CmFastMemCopyParallel(CmFastMemCopy_impl, dst, src, bytes);
 }
 
 void CmFastMemCopyWC( void* dst, const void* src, const size_t bytes )
 {
-    static const bool is_SSE2_available = (GetCpuInstructionLevel() >= CPU_INSTRUCTION_LEVEL_SSE2);
+    static const CPU_INSTRUCTION_LEVEL cpuInstructionLevel = GetCpuInstructionLevel();
+    static const bool is_AVX512_available = (cpuInstructionLevel >= CPU_INSTRUCTION_LEVEL_AVX512);
+    static const bool is_AVX2_available = (cpuInstructionLevel >= CPU_INSTRUCTION_LEVEL_AVX2);
+    static const bool is_SSE2_available = (cpuInstructionLevel >= CPU_INSTRUCTION_LEVEL_SSE2);
     static const t_CmFastMemCopyWC CmFastMemCopyWC_impl = CM_FAST_MEM_COPY_CPU_INIT(CmFastMemCopyWC);
 
-    CmFastMemCopyWC_impl(dst, src, bytes);
+    CmFastMemCopyParallel(CmFastMemCopyWC_impl, dst, src, bytes);
 }
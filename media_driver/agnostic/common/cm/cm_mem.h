@@ -40,6 +40,8 @@ enum CPU_INSTRUCTION_LEVEL
     CPU_INSTRUCTION_LEVEL_SSE3,
     CPU_INSTRUCTION_LEVEL_SSE4,
     CPU_INSTRUCTION_LEVEL_SSE4_1,
+    CPU_INSTRUCTION_LEVEL_AVX2,
+    CPU_INSTRUCTION_LEVEL_AVX512,
     NUM_CPU_INSTRUCTION_LEVELS
 };
 
@@ -63,8 +65,11 @@ inline size_t GetAlignmentOffset( void* const ptr, const size_t alignSize );
 inline bool IsAligned( void * ptr, const size_t alignSize );
 inline size_t Round( const size_t value, const size_t size );
 
+typedef void(*t_CmFastMemCopy)( void* dst, const void* src, const size_t bytes );
+
 void CmFastMemCopy( void* dst, const   void* src, const size_t bytes );
 void CmFastMemCopyWC( void* dst,   const void* src, const size_t bytes );
+void CmFastMemCopyParallel( t_CmFastMemCopy copyFunc, void* dst, const void* src, const size_t bytes );
 
 inline void Prefetch( const void* ptr );
 
@@ -119,6 +124,12 @@ Description:
 #define BIT( n )    ( 1 << (n) )
 #endif
 
+#define CM_CPU_FASTCOPY_PREFETCH_DISTANCE       ( 4 * sizeof(DHWORD) )  // prefetch 4 cache lines ahead
+#define CM_CPU_FASTCOPY_STREAMING_THRESHOLD     ( 256 * 1024 )          // larger copies bypass the cache
+#define CM_CPU_FASTCOPY_MT_THRESHOLD            ( 4 * 1024 * 1024 )     // larger copies are split across threads
+#define CM_CPU_FASTCOPY_MT_CHUNK_ALIGNMENT      4096
+#define CM_CPU_FASTCOPY_MT_MAX_THREADS          4
+
 #include "cm_mem_os.h"
 
 /*****************************************************************************\
@@ -215,17 +226,17 @@ inline int CmSafeMemCompare( const void* dst, const void* src, const size_t byte
 
 /*****************************************************************************\
 Inline Function:
-    GetCpuInstructionLevel
+    QueryCpuInstructionLevel
 
 Description:
-    Returns the highest level of IA32 intruction extensions supported by the CPU
-    ( i.e. SSE, SSE2, SSE4, etc )
+    Queries the highest level of IA32 intruction extensions supported by the CPU
+    ( i.e. SSE, SSE2, SSE4, etc ) through CPUID and XGETBV
 
 Output:
     CPU_INSTRUCTION_LEVEL - highest level of IA32 instruction extension(s) supported
     by CPU
 \*****************************************************************************/
-inline CPU_INSTRUCTION_LEVEL GetCpuInstructionLevel( void )
+inline CPU_INSTRUCTION_LEVEL QueryCpuInstructionLevel( void )
 {
     int cpuInfo[4];
     memset( cpuInfo, 0, 4*sizeof(int) );
@@ -236,6 +247,29 @@ inline CPU_INSTRUCTION_LEVEL GetCpuInstructionLevel( void )
     if( (cpuInfo[2] & BIT(19)) && TestSSE4_1() )
     {
         cpuInstructionLevel = CPU_INSTRUCTION_LEVEL_SSE4_1;
+
+        // AVX2 and AVX-512 also need the OS to save the YMM/ZMM state (OSXSAVE + XCR0)
+        if( cpuInfo[2] & BIT(27) )
+        {
+            const uint64_t xcr0 = GetXCR0();
+            int extInfo[4];
+            memset( extInfo, 0, 4*sizeof(int) );
+
+            GetCPUIDEx(extInfo, 7, 0);
+
+            const bool isYmmStateEnabled = ( (xcr0 & 0x6) == 0x6 );
+            const bool isZmmStateEnabled = ( (xcr0 & 0xe6) == 0xe6 );
+
+            if( isYmmStateEnabled && (extInfo[1] & BIT(5)) )
+            {
+                cpuInstructionLevel = CPU_INSTRUCTION_LEVEL_AVX2;
+
+                if( isZmmStateEnabled && (extInfo[1] & BIT(16)) )
+                {
+                    cpuInstructionLevel = CPU_INSTRUCTION_LEVEL_AVX512;
+                }
+            }
+        }
     }
     else if( cpuInfo[2] & BIT(1) )
     {
@@ -257,6 +291,25 @@ inline CPU_INSTRUCTION_LEVEL GetCpuInstructionLevel( void )
     return cpuInstructionLevel;
 }
 
+/*****************************************************************************\
+Inline Function:
+    GetCpuInstructionLevel
+
+Description:
+    Returns the highest level of IA32 intruction extensions supported by the CPU
+    ( i.e. SSE, SSE2, SSE4, etc ). The CPU is queried once, as callers ask for
+    every copied row and CPUID is expensive on virtualized hosts.
+
+Output:
+    CPU_INSTRUCTION_LEVEL - highest level of IA32 instruction extension(s) supported
+    by CPU
+\*****************************************************************************/
+inline CPU_INSTRUCTION_LEVEL GetCpuInstructionLevel( void )
+{
+    static const CPU_INSTRUCTION_LEVEL cpuInstructionLevel = QueryCpuInstructionLevel();
+    return cpuInstructionLevel;
+}
+
 /*****************************************************************************\
 Inline Function:
     Round
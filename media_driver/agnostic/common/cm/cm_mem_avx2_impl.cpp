@@ -0,0 +1,246 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file      cm_mem_avx2_impl.cpp
+//! \brief     Contains CM memory function implementations for AVX2
+//!
+
+#include "cm_mem.h"
+#include "cm_mem_avx2_impl.h"
+
+#if defined(__AVX2__)
+
+#include <immintrin.h>
+
+/*****************************************************************************\
+Function:
+    FastMemCopy_AVX2_CacheLines
+
+Description:
+    Copies whole cache lines (two YMM registers per line).
+
+Input:
+    dst - 32-byte aligned pointer to destination buffer
+    src - pointer to source buffer, 32-byte aligned if isSrcAligned is set
+    cacheLines - number of 64-byte cache lines to copy
+\*****************************************************************************/
+template <bool isSrcAligned, bool isStreamingStore>
+static void FastMemCopy_AVX2_CacheLines(
+    uint8_t* dst,
+    const uint8_t* src,
+    const size_t cacheLines )
+{
+    CM_ASSERT( IsAligned( dst, sizeof(__m256i) ) );
+
+    __m256i* dst256i = (__m256i*)dst;
+    const __m256i* src256i = (const __m256i*)src;
+
+    for( size_t i = 0; i < cacheLines; i++ )
+    {
+        Prefetch( (const uint8_t*)src256i + CM_CPU_FASTCOPY_PREFETCH_DISTANCE );
+
+        const __m256i ymm0 = isSrcAligned ? _mm256_load_si256( src256i ) : _mm256_loadu_si256( src256i );
+        const __m256i ymm1 = isSrcAligned ? _mm256_load_si256( src256i + 1 ) : _mm256_loadu_si256( src256i + 1 );
+        src256i += 2;
+
+        if( isStreamingStore )
+        {
+            _mm256_stream_si256( dst256i, ymm0 );
+            _mm256_stream_si256( dst256i + 1, ymm1 );
+        }
+        else
+        {
+            _mm256_store_si256( dst256i, ymm0 );
+            _mm256_store_si256( dst256i + 1, ymm1 );
+        }
+        dst256i += 2;
+    }
+
+    if( isStreamingStore )
+    {
+        // Make the non-temporal stores globally visible before returning
+        _mm_sfence();
+    }
+}
+
+static void FastMemCopy_AVX2(
+    uint8_t* dst,
+    const uint8_t* src,
+    const size_t cacheLines,
+    const bool isStreamingStore )
+{
+    const bool isSrcAligned = IsAligned( (void*)src, sizeof(__m256i) );
+
+    if( isSrcAligned && isStreamingStore )
+    {
+        FastMemCopy_AVX2_CacheLines<true, true>( dst, src, cacheLines );
+    }
+    else if( isStreamingStore )
+    {
+        FastMemCopy_AVX2_CacheLines<false, true>( dst, src, cacheLines );
+    }
+    else if( isSrcAligned )
+    {
+        FastMemCopy_AVX2_CacheLines<true, false>( dst, src, cacheLines );
+    }
+    else
+    {
+        FastMemCopy_AVX2_CacheLines<false, false>( dst, src, cacheLines );
+    }
+}
+
+static void FastMemCopyToAligned_AVX2(
+    void* dst,
+    const void* src,
+    const size_t bytes,
+    const bool isStreamingStore )
+{
+    // Cache pointers to memory
+    uint8_t *cacheDst = (uint8_t*)dst;
+    const uint8_t *cacheSrc = (const uint8_t*)src;
+
+    size_t count = bytes;
+
+    if( count >= CM_CPU_FASTCOPY_THRESHOLD )
+    {
+        // Align the destination to a cache line so each store fills a whole line
+        const size_t doubleHexWordAlignBytes =
+            GetAlignmentOffset( cacheDst, sizeof(DHWORD) );
+
+        if( doubleHexWordAlignBytes )
+        {
+            MOS_SecureMemcpy( cacheDst, doubleHexWordAlignBytes, cacheSrc, doubleHexWordAlignBytes );
+
+            cacheDst += doubleHexWordAlignBytes;
+            cacheSrc += doubleHexWordAlignBytes;
+            count -= doubleHexWordAlignBytes;
+        }
+
+        const size_t cacheLines = count / sizeof(DHWORD);
+
+        if( cacheLines )
+        {
+            FastMemCopy_AVX2( cacheDst, cacheSrc, cacheLines, isStreamingStore );
+
+            cacheDst += cacheLines * sizeof(DHWORD);
+            cacheSrc += cacheLines * sizeof(DHWORD);
+            count -= cacheLines * sizeof(DHWORD);
+        }
+    }
+
+    // Copy remaining uint8_t(s)
+    if( count )
+    {
+        MOS_SecureMemcpy( cacheDst, count, cacheSrc, count );
+    }
+}
+
+void CmFastMemCopy_AVX2( void* dst, const void* src, const size_t bytes )
+{
+    // Small copies are consumed right away, keep them in cache
+    FastMemCopyToAligned_AVX2( dst, src, bytes, bytes >= CM_CPU_FASTCOPY_STREAMING_THRESHOLD );
+}
+
+void CmFastMemCopyWC_AVX2( void* dst, const void* src, const size_t bytes )
+{
+    FastMemCopyToAligned_AVX2( dst, src, bytes, true );
+}
+
+void CmFastMemCopyFromWC_AVX2( void* dst, const void* src, const size_t bytes )
+{
+    // Cache pointers to memory
+    uint8_t *tempDst = (uint8_t*)dst;
+    uint8_t *tempSrc = (uint8_t*)src;
+
+    size_t count = bytes;
+
+    if( count >= CM_CPU_FASTCOPY_THRESHOLD )
+    {
+        // Streaming load must be 32-byte aligned but should
+        // be 64-byte aligned to read whole WC lines
+        const size_t doubleHexWordAlignBytes =
+            GetAlignmentOffset( tempSrc, sizeof(DHWORD) );
+
+        if( doubleHexWordAlignBytes )
+        {
+            MOS_SecureMemcpy( tempDst, doubleHexWordAlignBytes, tempSrc, doubleHexWordAlignBytes );
+
+            tempDst += doubleHexWordAlignBytes;
+            tempSrc += doubleHexWordAlignBytes;
+            count -= doubleHexWordAlignBytes;
+        }
+
+        CM_ASSERT( IsAligned( tempSrc, sizeof(DHWORD) ) == true );
+
+        const size_t cacheLines = count / sizeof(DHWORD);
+
+        if( cacheLines )
+        {
+            const bool isDstAligned = IsAligned( tempDst, sizeof(__m256i) );
+
+            __m256i* mmSrc = (__m256i*)tempSrc;
+            __m256i* mmDst = (__m256i*)tempDst;
+
+            // Sync the WC memory data before issuing the VMOVNTDQA instructions.
+            _mm_mfence();
+
+            if( isDstAligned )
+            {
+                for( size_t i = 0; i < cacheLines; i++ )
+                {
+                    const __m256i ymm0 = _mm256_stream_load_si256( mmSrc );
+                    const __m256i ymm1 = _mm256_stream_load_si256( mmSrc + 1 );
+                    mmSrc += 2;
+
+                    _mm256_store_si256( mmDst, ymm0 );
+                    _mm256_store_si256( mmDst + 1, ymm1 );
+                    mmDst += 2;
+                }
+            }
+            else
+            {
+                for( size_t i = 0; i < cacheLines; i++ )
+                {
+                    const __m256i ymm0 = _mm256_stream_load_si256( mmSrc );
+                    const __m256i ymm1 = _mm256_stream_load_si256( mmSrc + 1 );
+                    mmSrc += 2;
+
+                    _mm256_storeu_si256( mmDst, ymm0 );
+                    _mm256_storeu_si256( mmDst + 1, ymm1 );
+                    mmDst += 2;
+                }
+            }
+
+            tempDst += cacheLines * sizeof(DHWORD);
+            tempSrc += cacheLines * sizeof(DHWORD);
+            count -= cacheLines * sizeof(DHWORD);
+        }
+    }
+
+    // Copy remaining uint8_t(s)
+    if( count )
+    {
+        MOS_SecureMemcpy( tempDst, count, tempSrc, count );
+    }
+}
+
+#endif // __AVX2__
@@ -0,0 +1,74 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file      cm_mem_avx512_impl.h
+//! \brief     Contains CM memory function definitions for AVX-512
+//!
+#pragma once
+
+/*****************************************************************************\
+Function:
+    CmFastMemCopy_AVX512
+
+Description:
+    Memory Copy function for large amounts of data using AVX-512
+    Foundation instructions. Uses streaming stores once the copy no longer
+    fits in cache.
+
+Input:
+    dst - pointer to destination buffer
+    src - pointer to source buffer
+    bytes - number of bytes to copy
+\*****************************************************************************/
+void CmFastMemCopy_AVX512( void* dst, const void* src, const size_t bytes );
+
+/*****************************************************************************\
+Function:
+    CmFastMemCopyWC_AVX512
+
+Description:
+    Memory Copy function for large amounts of data using AVX-512
+    Foundation instructions. Always uses streaming stores to write-combined
+    memory.
+
+Input:
+    dst - pointer to write-combined destination buffer
+    src - pointer to source buffer
+    bytes - number of bytes to copy
+\*****************************************************************************/
+void CmFastMemCopyWC_AVX512( void* dst, const void* src, const size_t bytes );
+
+/*****************************************************************************\
+Function:
+    CmFastMemCopyFromWC_AVX512
+
+Description:
+    Memory Copy function for large amounts of data using AVX-512
+    Foundation instructions. Reads write-combined memory with streaming loads
+    (vmovntdqa).
+
+Input:
+    dst - pointer to destination buffer
+    src - pointer to write-combined source buffer
+    bytes - number of bytes to copy
+\*****************************************************************************/
+void CmFastMemCopyFromWC_AVX512( void* dst, const void* src, const size_t bytes );
@@ -83,6 +83,7 @@ int32_t CmSurfaceManagerBase::UpdateStateForRealDestroy(uint32_t index,
     }
 
     m_surfaceArray[index] = nullptr;
+    MarkSurfaceIndexFree(index);
 
     m_surfaceSizes[index] = 0;
 
@@ -181,6 +182,10 @@ CmSurfaceManagerBase::CmSurfaceManagerBase(CmDeviceRT* device) :
     m_surfaceArray(nullptr),
     m_maxSurfaceIndexAllocated(0),
     m_surfaceSizes(nullptr),
+    m_freeIndexBitmap(nullptr),
+    m_freeIndexSummary(nullptr),
+    m_freeIndexBitmapSize(0),
+    m_freeIndexSummarySize(0),
     m_maxBufferCount(0),
     m_bufferCount(0),
     m_max2DSurfaceCount(0),
@@ -232,6 +237,8 @@ CmSurfaceManagerBase::~CmSurfaceManagerBase()
     printf("\n\n");
 #endif
 
+    MosSafeDeleteArray(m_freeIndexSummary);
+    MosSafeDeleteArray(m_freeIndexBitmap);
     MosSafeDeleteArray(m_surfaceSizes);
     MosSafeDeleteArray(m_surfaceArray);
 
@@ -369,12 +376,21 @@ int32_t CmSurfaceManagerBase::Initialize( CM_HAL_MAX_VALUES halMaxValues,
 
     typedef CmSurface* PCMSURFACE;
 
+    m_freeIndexBitmapSize  = (m_surfaceArraySize + 63) / 64;
+    m_freeIndexSummarySize = (m_freeIndexBitmapSize + 63) / 64;
+
     m_surfaceArray      = MOS_NewArray(PCMSURFACE, m_surfaceArraySize);
     m_surfaceSizes      = MOS_NewArray(int32_t, m_surfaceArraySize);
+    m_freeIndexBitmap   = MOS_NewArray(uint64_t, m_freeIndexBitmapSize);
+    m_freeIndexSummary  = MOS_NewArray(uint64_t, m_freeIndexSummarySize);
 
     if( m_surfaceArray == nullptr ||
-        m_surfaceSizes == nullptr)
+        m_surfaceSizes == nullptr ||
+        m_freeIndexBitmap == nullptr ||
+        m_freeIndexSummary == nullptr)
     {
+        MosSafeDeleteArray(m_freeIndexSummary);
+        MosSafeDeleteArray(m_freeIndexBitmap);
         MosSafeDeleteArray(m_surfaceSizes);
         MosSafeDeleteArray(m_surfaceArray);
 
@@ -384,6 +400,13 @@ int32_t CmSurfaceManagerBase::Initialize( CM_HAL_MAX_VALUES halMaxValues,
 
     CmSafeMemSet( m_surfaceArray, 0, m_surfaceArraySize * sizeof( CmSurface* ) );
     CmSafeMemSet( m_surfaceSizes, 0, m_surfaceArraySize * sizeof( int32_t ) );
+    CmSafeMemSet( m_freeIndexBitmap, 0, m_freeIndexBitmapSize * sizeof( uint64_t ) );
+    CmSafeMemSet( m_freeIndexSummary, 0, m_freeIndexSummarySize * sizeof( uint64_t ) );
+
+    for (uint32_t index = ValidSurfaceIndexStart(); index < m_surfaceArraySize; index++)
+    {
+        MarkSurfaceIndexFree(index);
+    }
 
     return CM_SUCCESS;
 }
@@ -407,6 +430,15 @@ int32_t CmSurfaceManagerBase::RefreshDelayDestroySurfaces(uint32_t &freeSurfaceC
         status = CM_FAILURE;
         CmSurface *next = surface->DelayDestroyNext();
 
+        // Surfaces still referenced by in-flight tasks stay in the list, no
+        // need to go through the per-type destroy path for them.
+        if (!surface->CanBeDestroyed())
+        {
+            surface = next;
+            ++ count;
+            continue;
+        }
+
         switch (surface->Type())
         {
         case CM_ENUM_CLASS_TYPE_CMSURFACE2D :
@@ -507,24 +539,71 @@ int32_t CmSurfaceManagerBase::TouchSurfaceInPoolForDestroy()
     return freeNum;
 }
 
-int32_t CmSurfaceManagerBase::GetFreeSurfaceIndexFromPool(uint32_t &freeIndex)
+static inline uint32_t FindFirstSetBit(uint64_t word)
 {
-    uint32_t index = ValidSurfaceIndexStart();
+#if defined(__GNUC__)
+    return (uint32_t)__builtin_ctzll(word);
+#else
+    uint32_t bit = 0;
+    while (!(word & 1))
+    {
+        word >>= 1;
+        bit++;
+    }
+    return bit;
+#endif
+}
 
-    while( ( index < m_surfaceArraySize ) && m_surfaceArray[ index ] )
+void CmSurfaceManagerBase::MarkSurfaceIndexFree(uint32_t index)
+{
+    if (index >= m_surfaceArraySize || m_freeIndexBitmap == nullptr)
     {
-        index ++;
+        return;
     }
 
-    if( index >= m_surfaceArraySize )
+    uint32_t word = index >> 6;
+    m_freeIndexBitmap[word] |= (1ull << (index & 63));
+    m_freeIndexSummary[word >> 6] |= (1ull << (word & 63));
+}
+
+void CmSurfaceManagerBase::MarkSurfaceIndexUsed(uint32_t index)
+{
+    if (index >= m_surfaceArraySize || m_freeIndexBitmap == nullptr)
     {
-        CM_ASSERTMESSAGE("Error: Invalid surface index.");
-        return CM_FAILURE;
+        return;
     }
 
-    freeIndex = index;
+    uint32_t word = index >> 6;
+    m_freeIndexBitmap[word] &= ~(1ull << (index & 63));
+    if (m_freeIndexBitmap[word] == 0)
+    {
+        m_freeIndexSummary[word >> 6] &= ~(1ull << (word & 63));
+    }
+}
 
-    return CM_SUCCESS;
+int32_t CmSurfaceManagerBase::GetFreeSurfaceIndexFromPool(uint32_t &freeIndex)
+{
+    // Callers fill m_surfaceArray after getting the index, so a candidate may
+    // already be taken. Drop such candidates here; each one is dropped once.
+    for (uint32_t summary = 0; summary < m_freeIndexSummarySize; summary++)
+    {
+        while (m_freeIndexSummary[summary])
+        {
+            uint32_t word = (summary << 6) + FindFirstSetBit(m_freeIndexSummary[summary]);
+            uint32_t index = (word << 6) + FindFirstSetBit(m_freeIndexBitmap[word]);
+
+            if (m_surfaceArray[index] == nullptr)
+            {
+                freeIndex = index;
+                return CM_SUCCESS;
+            }
+
+            MarkSurfaceIndexUsed(index);
+        }
+    }
+
+    CM_ASSERTMESSAGE("Error: Invalid surface index.");
+    return CM_FAILURE;
 }
 
 int32_t CmSurfaceManagerBase::GetFreeSurfaceIndex(uint32_t &freeIndex)
@@ -118,6 +118,8 @@ public:
     int32_t TouchSurfaceInPoolForDestroy();
     int32_t GetFreeSurfaceIndexFromPool(uint32_t &freeIndex);
     int32_t GetFreeSurfaceIndex(uint32_t &index);
+    void MarkSurfaceIndexFree(uint32_t index);
+    void MarkSurfaceIndexUsed(uint32_t index);
 
     int32_t AllocateSurfaceIndex(size_t width, uint32_t height,
                                  uint32_t depth, CM_SURFACE_FORMAT format,
@@ -212,6 +214,15 @@ protected:
     // Size of each surface in surface array
     int32_t *m_surfaceSizes;
 
+    // Two-level bitmap of surface array entries that may be free. A set bit in
+    // m_freeIndexBitmap marks a candidate entry, a set bit in m_freeIndexSummary
+    // marks a bitmap word with at least one candidate. Entries taken by a
+    // surface are cleared lazily when the lookup finds them occupied.
+    uint64_t *m_freeIndexBitmap;
+    uint64_t *m_freeIndexSummary;
+    uint32_t m_freeIndexBitmapSize;
+    uint32_t m_freeIndexSummarySize;
+
     uint32_t m_maxBufferCount;
     uint32_t m_bufferCount;
 
@@ -86,6 +86,8 @@ set(TMP_HEADERS_
     ${CMAKE_CURRENT_LIST_DIR}/cm_log.h
     ${CMAKE_CURRENT_LIST_DIR}/cm_mem_c_impl.h
     ${CMAKE_CURRENT_LIST_DIR}/cm_mem_sse2_impl.h
+    ${CMAKE_CURRENT_LIST_DIR}/cm_mem_avx2_impl.h
+    ${CMAKE_CURRENT_LIST_DIR}/cm_mem_avx512_impl.h
     ${CMAKE_CURRENT_LIST_DIR}/cm_mem.h
     ${CMAKE_CURRENT_LIST_DIR}/cm_mov_inst.h
     ${CMAKE_CURRENT_LIST_DIR}/cm_perf.h
@@ -167,6 +169,12 @@ set(HEADERS_
 set(SOURCES_SSE2
     ${CMAKE_CURRENT_LIST_DIR}/cm_mem_sse2_impl.cpp)
 
+set(SOURCES_AVX2
+    ${CMAKE_CURRENT_LIST_DIR}/cm_mem_avx2_impl.cpp)
+
+set(SOURCES_AVX512
+    ${CMAKE_CURRENT_LIST_DIR}/cm_mem_avx512_impl.cpp)
+
 source_group(CM FILES ${TMP_SOURCES_} ${TMP_HEADERS_} ${TMP_1_SOURCES_} ${TMP_1_HEADERS_})
 
 media_add_curr_to_include_path()
\ No newline at end of file
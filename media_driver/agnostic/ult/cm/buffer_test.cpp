@@ -71,6 +71,67 @@ public:
         return m_mockDevice->DestroySurface(m_buffer);
     }//===============================================
 
+    //! Round-trips buffers through WriteSurface and ReadSurface. Copies of
+    //! CM_CPU_FASTCOPY_MT_THRESHOLD bytes or more are split into chunks done by
+    //! several threads, so sizes and patterns are picked to catch a chunk copied
+    //! at a wrong offset, skipped, or written past its end.
+    int32_t SplitCopyReadWrite(uint32_t size)
+    {
+        const uint32_t GUARD = 4096;
+        const uint32_t ROUNDS = 3;
+        uint8_t *to_buffer
+                = static_cast<uint8_t*>(AllocateAlignedMemory(size, 0x1000));
+        uint8_t *from_buffer
+                = static_cast<uint8_t*>(AllocateAlignedMemory(size + GUARD, 0x1000));
+
+        int32_t result = m_mockDevice->CreateBuffer(size, m_buffer);
+        EXPECT_EQ(CM_SUCCESS, result);
+        if (result != CM_SUCCESS)
+        {
+            FreeAlignedMemory(to_buffer);
+            FreeAlignedMemory(from_buffer);
+            return result;
+        }
+
+        // A new pattern each round, so a chunk left over from the previous copy shows up
+        for (uint32_t round = 0; round < ROUNDS; ++round)
+        {
+            for (uint32_t i = 0; i < size; ++i)
+            {
+                to_buffer[i] = static_cast<uint8_t>(i*7 + (i >> 12) + round*31);
+            }
+            memset(from_buffer, 0xa5, size + GUARD);
+
+            result = m_buffer->WriteSurface(to_buffer, nullptr);
+            EXPECT_EQ(CM_SUCCESS, result);
+            result = m_buffer->ReadSurface(from_buffer, nullptr);
+            EXPECT_EQ(CM_SUCCESS, result);
+
+            for (uint32_t i = 0; i < size; ++i)
+            {
+                if (to_buffer[i] != from_buffer[i])
+                {
+                    ADD_FAILURE() << "size " << size << " round " << round
+                                  << " first mismatch at byte " << i;
+                    break;
+                }
+            }
+            for (uint32_t i = size; i < size + GUARD; ++i)
+            {
+                if (from_buffer[i] != 0xa5)
+                {
+                    ADD_FAILURE() << "size " << size << " round " << round
+                                  << " copy wrote past the end at byte " << i;
+                    break;
+                }
+            }
+        }
+
+        FreeAlignedMemory(to_buffer);
+        FreeAlignedMemory(from_buffer);
+        return m_mockDevice->DestroySurface(m_buffer);
+    }//===============================================
+
     int32_t Initialize()
     {
         int32_t result = m_mockDevice->CreateBuffer(SIZE, m_buffer);
@@ -130,3 +191,18 @@ TEST_F(BufferTest, Initialization)
                      [this]() { return Initialize(); });
     return;
 }//========
+
+TEST_F(BufferTest, SplitCopyReadWrite)
+{
+    // Sizes straddle the multi-thread threshold, with tails shorter than a
+    // chunk and chunk sizes which are not a multiple of the page alignment.
+    const uint32_t sizes[] = {4*1024*1024 - 1, 4*1024*1024, 4*1024*1024 + 1,
+                              4*1024*1024 + 4095, 5*1024*1024 + 3,
+                              16*1024*1024 + 64};
+    for (uint32_t size : sizes)
+    {
+        RunEach<int32_t>(CM_SUCCESS,
+                         [this, size]() { return SplitCopyReadWrite(size); });
+    }
+    return;
+}//========
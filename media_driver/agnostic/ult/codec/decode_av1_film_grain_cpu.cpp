@@ -0,0 +1,692 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     decode_av1_film_grain_cpu.cpp
+//! \brief    Defines the CPU implementation of av1 film grain synthesis
+//!
+#include "decode_av1_film_grain_cpu.h"
+
+namespace decode
+{
+    // Constant values
+    // Samples with Gaussian distribution in the range of [-2048, 2047] (12 bits)
+    // with zero mean and standard deviation of about 512.
+    // should be divided by 4 for 10-bit range and 16 for 8-bit range.
+    static const int16_t gaussianSequence[2048] = {
+        56,    568,   -180,  172,   124,   -84,   172,   -64,   -900,  24,   820,
+        224,   1248,  996,   272,   -8,    -916,  -388,  -732,  -104,  -188, 800,
+        112,   -652,  -320,  -376,  140,   -252,  492,   -168,  44,    -788, 588,
+        -584,  500,   -228,  12,    680,   272,   -476,  972,   -100,  652,  368,
+        432,   -196,  -720,  -192,  1000,  -332,  652,   -136,  -552,  -604, -4,
+        192,   -220,  -136,  1000,  -52,   372,   -96,   -624,  124,   -24,  396,
+        540,   -12,   -104,  640,   464,   244,   -208,  -84,   368,   -528, -740,
+        248,   -968,  -848,  608,   376,   -60,   -292,  -40,   -156,  252,  -292,
+        248,   224,   -280,  400,   -244,  244,   -60,   76,    -80,   212,  532,
+        340,   128,   -36,   824,   -352,  -60,   -264,  -96,   -612,  416,  -704,
+        220,   -204,  640,   -160,  1220,  -408,  900,   336,   20,    -336, -96,
+        -792,  304,   48,    -28,   -1232, -1172, -448,  104,   -292,  -520, 244,
+        60,    -948,  0,     -708,  268,   108,   356,   -548,  488,   -344, -136,
+        488,   -196,  -224,  656,   -236,  -1128, 60,    4,     140,   276,  -676,
+        -376,  168,   -108,  464,   8,     564,   64,    240,   308,   -300, -400,
+        -456,  -136,  56,    120,   -408,  -116,  436,   504,   -232,  328,  844,
+        -164,  -84,   784,   -168,  232,   -224,  348,   -376,  128,   568,  96,
+        -1244, -288,  276,   848,   832,   -360,  656,   464,   -384,  -332, -356,
+        728,   -388,  160,   -192,  468,   296,   224,   140,   -776,  -100, 280,
+        4,     196,   44,    -36,   -648,  932,   16,    1428,  28,    528,  808,
+        772,   20,    268,   88,    -332,  -284,  124,   -384,  -448,  208,  -228,
+        -1044, -328,  660,   380,   -148,  -300,  588,   240,   540,   28,   136,
+        -88,   -436,  256,   296,   -1000, 1400,  0,     -48,   1056,  -136, 264,
+        -528,  -1108, 632,   -484,  -592,  -344,  796,   124,   -668,  -768, 388,
+        1296,  -232,  -188,  -200,  -288,  -4,    308,   100,   -168,  256,  -500,
+        204,   -508,  648,   -136,  372,   -272,  -120,  -1004, -552,  -548, -384,
+        548,   -296,  428,   -108,  -8,    -912,  -324,  -224,  -88,   -112, -220,
+        -100,  996,   -796,  548,   360,   -216,  180,   428,   -200,  -212, 148,
+        96,    148,   284,   216,   -412,  -320,  120,   -300,  -384,  -604, -572,
+        -332,  -8,    -180,  -176,  696,   116,   -88,   628,   76,    44,   -516,
+        240,   -208,  -40,   100,   -592,  344,   -308,  -452,  -228,  20,   916,
+        -1752, -136,  -340,  -804,  140,   40,    512,   340,   248,   184,  -492,
+        896,   -156,  932,   -628,  328,   -688,  -448,  -616,  -752,  -100, 560,
+        -1020, 180,   -800,  -64,   76,    576,   1068,  396,   660,   552,  -108,
+        -28,   320,   -628,  312,   -92,   -92,   -472,  268,   16,    560,  516,
+        -672,  -52,   492,   -100,  260,   384,   284,   292,   304,   -148, 88,
+        -152,  1012,  1064,  -228,  164,   -376,  -684,  592,   -392,  156,  196,
+        -524,  -64,   -884,  160,   -176,  636,   648,   404,   -396,  -436, 864,
+        424,   -728,  988,   -604,  904,   -592,  296,   -224,  536,   -176, -920,
+        436,   -48,   1176,  -884,  416,   -776,  -824,  -884,  524,   -548, -564,
+        -68,   -164,  -96,   692,   364,   -692,  -1012, -68,   260,   -480, 876,
+        -1116, 452,   -332,  -352,  892,   -1088, 1220,  -676,  12,    -292, 244,
+        496,   372,   -32,   280,   200,   112,   -440,  -96,   24,    -644, -184,
+        56,    -432,  224,   -980,  272,   -260,  144,   -436,  420,   356,  364,
+        -528,  76,    172,   -744,  -368,  404,   -752,  -416,  684,   -688, 72,
+        540,   416,   92,    444,   480,   -72,   -1416, 164,   -1172, -68,  24,
+        424,   264,   1040,  128,   -912,  -524,  -356,  64,    876,   -12,  4,
+        -88,   532,   272,   -524,  320,   276,   -508,  940,   24,    -400, -120,
+        756,   60,    236,   -412,  100,   376,   -484,  400,   -100,  -740, -108,
+        -260,  328,   -268,  224,   -200,  -416,  184,   -604,  -564,  -20,  296,
+        60,    892,   -888,  60,    164,   68,    -760,  216,   -296,  904,  -336,
+        -28,   404,   -356,  -568,  -208,  -1480, -512,  296,   328,   -360, -164,
+        -1560, -776,  1156,  -428,  164,   -504,  -112,  120,   -216,  -148, -264,
+        308,   32,    64,    -72,   72,    116,   176,   -64,   -272,  460,  -536,
+        -784,  -280,  348,   108,   -752,  -132,  524,   -540,  -776,  116,  -296,
+        -1196, -288,  -560,  1040,  -472,  116,   -848,  -1116, 116,   636,  696,
+        284,   -176,  1016,  204,   -864,  -648,  -248,  356,   972,   -584, -204,
+        264,   880,   528,   -24,   -184,  116,   448,   -144,  828,   524,  212,
+        -212,  52,    12,    200,   268,   -488,  -404,  -880,  824,   -672, -40,
+        908,   -248,  500,   716,   -576,  492,   -576,  16,    720,   -108, 384,
+        124,   344,   280,   576,   -500,  252,   104,   -308,  196,   -188, -8,
+        1268,  296,   1032,  -1196, 436,   316,   372,   -432,  -200,  -660, 704,
+        -224,  596,   -132,  268,   32,    -452,  884,   104,   -1008, 424,  -1348,
+        -280,  4,     -1168, 368,   476,   696,   300,   -8,    24,    180,  -592,
+        -196,  388,   304,   500,   724,   -160,  244,   -84,   272,   -256, -420,
+        320,   208,   -144,  -156,  156,   364,   452,   28,    540,   316,  220,
+        -644,  -248,  464,   72,    360,   32,    -388,  496,   -680,  -48,  208,
+        -116,  -408,  60,    -604,  -392,  548,   -840,  784,   -460,  656,  -544,
+        -388,  -264,  908,   -800,  -628,  -612,  -568,  572,   -220,  164,  288,
+        -16,   -308,  308,   -112,  -636,  -760,  280,   -668,  432,   364,  240,
+        -196,  604,   340,   384,   196,   592,   -44,   -500,  432,   -580, -132,
+        636,   -76,   392,   4,     -412,  540,   508,   328,   -356,  -36,  16,
+        -220,  -64,   -248,  -60,   24,    -192,  368,   1040,  92,    -24,  -1044,
+        -32,   40,    104,   148,   192,   -136,  -520,  56,    -816,  -224, 732,
+        392,   356,   212,   -80,   -424,  -1008, -324,  588,   -1496, 576,  460,
+        -816,  -848,  56,    -580,  -92,   -1372, -112,  -496,  200,   364,  52,
+        -140,  48,    -48,   -60,   84,    72,    40,    132,   -356,  -268, -104,
+        -284,  -404,  732,   -520,  164,   -304,  -540,  120,   328,   -76,  -460,
+        756,   388,   588,   236,   -436,  -72,   -176,  -404,  -316,  -148, 716,
+        -604,  404,   -72,   -88,   -888,  -68,   944,   88,    -220,  -344, 960,
+        472,   460,   -232,  704,   120,   832,   -228,  692,   -508,  132,  -476,
+        844,   -748,  -364,  -44,   1116,  -1104, -1056, 76,    428,   552,  -692,
+        60,    356,   96,    -384,  -188,  -612,  -576,  736,   508,   892,  352,
+        -1132, 504,   -24,   -352,  324,   332,   -600,  -312,  292,   508,  -144,
+        -8,    484,   48,    284,   -260,  -240,  256,   -100,  -292,  -204, -44,
+        472,   -204,  908,   -188,  -1000, -256,  92,    1164,  -392,  564,  356,
+        652,   -28,   -884,  256,   484,   -192,  760,   -176,  376,   -524, -452,
+        -436,  860,   -736,  212,   124,   504,   -476,  468,   76,    -472, 552,
+        -692,  -944,  -620,  740,   -240,  400,   132,   20,    192,   -196, 264,
+        -668,  -1012, -60,   296,   -316,  -828,  76,    -156,  284,   -768, -448,
+        -832,  148,   248,   652,   616,   1236,  288,   -328,  -400,  -124, 588,
+        220,   520,   -696,  1032,  768,   -740,  -92,   -272,  296,   448,  -464,
+        412,   -200,  392,   440,   -200,  264,   -152,  -260,  320,   1032, 216,
+        320,   -8,    -64,   156,   -1016, 1084,  1172,  536,   484,   -432, 132,
+        372,   -52,   -256,  84,    116,   -352,  48,    116,   304,   -384, 412,
+        924,   -300,  528,   628,   180,   648,   44,    -980,  -220,  1320, 48,
+        332,   748,   524,   -268,  -720,  540,   -276,  564,   -344,  -208, -196,
+        436,   896,   88,    -392,  132,   80,    -964,  -288,  568,   56,   -48,
+        -456,  888,   8,     552,   -156,  -292,  948,   288,   128,   -716, -292,
+        1192,  -152,  876,   352,   -600,  -260,  -812,  -468,  -28,   -120, -32,
+        -44,   1284,  496,   192,   464,   312,   -76,   -516,  -380,  -456, -1012,
+        -48,   308,   -156,  36,    492,   -156,  -808,  188,   1652,  68,   -120,
+        -116,  316,   160,   -140,  352,   808,   -416,  592,   316,   -480, 56,
+        528,   -204,  -568,  372,   -232,  752,   -344,  744,   -4,    324,  -416,
+        -600,  768,   268,   -248,  -88,   -132,  -420,  -432,  80,    -288, 404,
+        -316,  -1216, -588,  520,   -108,  92,    -320,  368,   -480,  -216, -92,
+        1688,  -300,  180,   1020,  -176,  820,   -68,   -228,  -260,  436,  -904,
+        20,    40,    -508,  440,   -736,  312,   332,   204,   760,   -372, 728,
+        96,    -20,   -632,  -520,  -560,  336,   1076,  -64,   -532,  776,  584,
+        192,   396,   -728,  -520,  276,   -188,  80,    -52,   -612,  -252, -48,
+        648,   212,   -688,  228,   -52,   -260,  428,   -412,  -272,  -404, 180,
+        816,   -796,  48,    152,   484,   -88,   -216,  988,   696,   188,  -528,
+        648,   -116,  -180,  316,   476,   12,    -564,  96,    476,   -252, -364,
+        -376,  -392,  556,   -256,  -576,  260,   -352,  120,   -16,   -136, -260,
+        -492,  72,    556,   660,   580,   616,   772,   436,   424,   -32,  -324,
+        -1268, 416,   -324,  -80,   920,   160,   228,   724,   32,    -516, 64,
+        384,   68,    -128,  136,   240,   248,   -204,  -68,   252,   -932, -120,
+        -480,  -628,  -84,   192,   852,   -404,  -288,  -132,  204,   100,  168,
+        -68,   -196,  -868,  460,   1080,  380,   -80,   244,   0,     484,  -888,
+        64,    184,   352,   600,   460,   164,   604,   -196,  320,   -64,  588,
+        -184,  228,   12,    372,   48,    -848,  -344,  224,   208,   -200, 484,
+        128,   -20,   272,   -468,  -840,  384,   256,   -720,  -520,  -464, -580,
+        112,   -120,  644,   -356,  -208,  -608,  -528,  704,   560,   -424, 392,
+        828,   40,    84,    200,   -152,  0,     -144,  584,   280,   -120, 80,
+        -556,  -972,  -196,  -472,  724,   80,    168,   -32,   88,    160,  -688,
+        0,     160,   356,   372,   -776,  740,   -128,  676,   -248,  -480, 4,
+        -364,  96,    544,   232,   -1032, 956,   236,   356,   20,    -40,  300,
+        24,    -676,  -596,  132,   1120,  -104,  532,   -1096, 568,   648,  444,
+        508,   380,   188,   -376,  -604,  1488,  424,   24,    756,   -220, -192,
+        716,   120,   920,   688,   168,   44,    -460,  568,   284,   1144, 1160,
+        600,   424,   888,   656,   -356,  -320,  220,   316,   -176,  -724, -188,
+        -816,  -628,  -348,  -228,  -380,  1012,  -452,  -660,  736,   928,  404,
+        -696,  -72,   -268,  -892,  128,   184,   -344,  -780,  360,   336,  400,
+        344,   428,   548,   -112,  136,   -228,  -216,  -820,  -516,  340,  92,
+        -136,  116,   -300,  376,   -244,  100,   -316,  -520,  -284,  -12,  824,
+        164,   -548,  -180,  -128,  116,   -924,  -828,  268,   -368,  -580, 620,
+        192,   160,   0,     -1676, 1068,  424,   -56,   -360,  468,   -156, 720,
+        288,   -528,  556,   -364,  548,   -148,  504,   316,   152,   -648, -620,
+        -684,  -24,   -376,  -384,  -108,  -920,  -1032, 768,   180,   -264, -508,
+        -1268, -260,  -60,   300,   -240,  988,   724,   -376,  -576,  -212, -736,
+        556,   192,   1092,  -620,  -880,  376,   -56,   -4,    -216,  -32,  836,
+        268,   396,   1332,  864,   -600,  100,   56,    -412,  -92,   356,  180,
+        884,   -468,  -436,  292,   -388,  -804,  -704,  -840,  368,   -348, 140,
+        -724,  1536,  940,   372,   112,   -372,  436,   -480,  1136,  296,  -32,
+        -228,  132,   -48,   -220,  868,   -1016, -60,   -1044, -464,  328,  916,
+        244,   12,    -736,  -296,  360,   468,   -376,  -108,  -92,   788,  368,
+        -56,   544,   400,   -672,  -420,  728,   16,    320,   44,    -284, -380,
+        -796,  488,   132,   204,   -596,  -372,  88,    -152,  -908,  -636, -572,
+        -624,  -116,  -692,  -200,  -56,   276,   -88,   484,   -324,  948,  864,
+        1000,  -456,  -184,  -276,  292,   -296,  156,   676,   320,   160,  908,
+        -84,   -1236, -288,  -116,  260,   -372,  -644,  732,   -756,  -96,  84,
+        344,   -520,  348,   -688,  240,   -84,   216,   -1044, -136,  -676, -396,
+        -1500, 960,   -40,   176,   168,   1516,  420,   -504,  -344,  -364, -360,
+        1216,  -940,  -380,  -212,  252,   -660,  -708,  484,   -444,  -152, 928,
+        -120,  1112,  476,   -260,  560,   -148,  -344,  108,   -196,  228,  -288,
+        504,   560,   -328,  -88,   288,   -1008, 460,   -228,  468,   -836, -196,
+        76,    388,   232,   412,   -1168, -716,  -644,  756,   -172,  -356, -504,
+        116,   432,   528,   48,    476,   -168,  -608,  448,   160,   -532, -272,
+        28,    -676,  -12,   828,   980,   456,   520,   104,   -104,  256,  -344,
+        -4,    -28,   -368,  -52,   -524,  -572,  -556,  -200,  768,   1124, -208,
+        -512,  176,   232,   248,   -148,  -888,  604,   -600,  -304,  804,  -156,
+        -212,  488,   -192,  -804,  -256,  368,   -360,  -916,  -328,  228,  -240,
+        -448,  -472,  856,   -556,  -364,  572,   -12,   -156,  -368,  -340, 432,
+        252,   -752,  -152,  288,   268,   -580,  -848,  -592,  108,   -76,  244,
+        312,   -716,  592,   -80,   436,   360,   4,     -248,  160,   516,  584,
+        732,   44,    -468,  -280,  -292,  -156,  -588,  28,    308,   912,  24,
+        124,   156,   180,   -252,  944,   -924,  -772,  -520,  -428,  -624, 300,
+        -212,  -1144, 32,    -724,  800,   -1128, -212,  -1288, -848,  180,  -416,
+        440,   192,   -576,  -792,  -76,   -1080, 80,    -532,  -352,  -132, 380,
+        -820,  148,   1112,  128,   164,   456,   700,   -924,  144,   -668, -384,
+        648,   -832,  508,   552,   -52,   -100,  -656,  208,   -568,  748,  -88,
+        680,   232,   300,   192,   -408,  -1012, -152,  -252,  -268,  272,  -876,
+        -664,  -648,  -332,  -136,  16,    12,    1152,  -28,   332,   -536, 320,
+        -672,  -460,  -316,  532,   -260,  228,   -40,   1052,  -816,  180,  88,
+        -496,  -556,  -672,  -368,  428,   92,    356,   404,   -408,  252,  196,
+        -176,  -556,  792,   268,   32,    372,   40,    96,    -332,  328,  120,
+        372,   -900,  -40,   472,   -264,  -592,  952,   128,   656,   112,  664,
+        -232,  420,   4,     -344,  -464,  556,   244,   -416,  -32,   252,  0,
+        -412,  188,   -696,  508,   -476,  324,   -1096, 656,   -312,  560,  264,
+        -136,  304,   160,   -64,   -580,  248,   336,   -720,  560,   -348, -288,
+        -276,  -196,  -500,  852,   -544,  -236,  -1128, -992,  -776,  116,  56,
+        52,    860,   884,   212,   -12,   168,   1020,  512,   -552,  924,  -148,
+        716,   188,   164,   -340,  -520,  -184,  880,   -152,  -680,  -208, -1156,
+        -300,  -528,  -472,  364,   100,   -744,  -1056, -32,   540,   280,  144,
+        -676,  -32,   -232,  -280,  -224,  96,    568,   -76,   172,   148,  148,
+        104,   32,    -296,  -32,   788,   -80,   32,    -16,   280,   288,  944,
+        428,   -484
+    };
+
+    static inline int32_t Round2(int32_t x, uint32_t n)
+    {
+        return n ? ((x + (1 << (n - 1))) >> n) : x;
+    }
+
+    uint16_t Av1FilmGrainCpu::GetRandomNumber(uint16_t &randomRegister, uint32_t bits)
+    {
+        uint16_t r   = randomRegister;
+        uint16_t bit = ((r >> 0) ^ (r >> 1) ^ (r >> 3) ^ (r >> 12)) & 1;
+        r            = (r >> 1) | (bit << 15);
+
+        randomRegister = r;
+        return (r >> (16 - bits)) & ((1 << bits) - 1);
+    }
+
+    MOS_STATUS Av1FilmGrainCpu::Init(const CodecAv1FilmGrainParams &params, uint8_t bitDepth,
+        uint32_t width, uint32_t height, bool identityMatrix)
+    {
+        if ((bitDepth != 8 && bitDepth != 10 && bitDepth != 12) || width == 0 || height == 0 ||
+            params.m_numYPoints > 14 || params.m_numCbPoints > 10 || params.m_numCrPoints > 10)
+        {
+            return MOS_STATUS_INVALID_PARAMETER;
+        }
+
+        m_params   = params;
+        m_bitDepth = bitDepth;
+        m_width    = width;
+        m_height   = height;
+
+        int32_t grainCenter = 128 << (m_bitDepth - 8);
+        m_grainMin          = -grainCenter;
+        m_grainMax          = (256 << (m_bitDepth - 8)) - 1 - grainCenter;
+
+        if (m_params.m_filmGrainInfoFlags.m_fields.m_clipToRestrictedRange)
+        {
+            m_minValue  = 16 << (m_bitDepth - 8);
+            m_maxLuma   = 235 << (m_bitDepth - 8);
+            m_maxChroma = identityMatrix ? m_maxLuma : (240 << (m_bitDepth - 8));
+        }
+        else
+        {
+            m_minValue  = 0;
+            m_maxLuma   = (256 << (m_bitDepth - 8)) - 1;
+            m_maxChroma = m_maxLuma;
+        }
+
+        MOS_STATUS status = InitScalingLut(m_params.m_pointYValue, m_params.m_pointYScaling,
+            m_params.m_numYPoints, m_scalingLut[0]);
+        if (status != MOS_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        if (m_params.m_filmGrainInfoFlags.m_fields.m_chromaScalingFromLuma)
+        {
+            m_scalingLut[1] = m_scalingLut[0];
+            m_scalingLut[2] = m_scalingLut[0];
+        }
+        else
+        {
+            status = InitScalingLut(m_params.m_pointCbValue, m_params.m_pointCbScaling,
+                m_params.m_numCbPoints, m_scalingLut[1]);
+            if (status != MOS_STATUS_SUCCESS)
+            {
+                return status;
+            }
+            status = InitScalingLut(m_params.m_pointCrValue, m_params.m_pointCrScaling,
+                m_params.m_numCrPoints, m_scalingLut[2]);
+            if (status != MOS_STATUS_SUCCESS)
+            {
+                return status;
+            }
+        }
+
+        // Noise is laid in blocks of 32x32 luma samples picked from the grain templates,
+        // one stripe per row of blocks. A block writes 2 extra columns and rows for overlap.
+        m_stripeNum   = MOS_ROUNDUP_DIVIDE((m_height + 1) / 2, 16);
+        m_stripeWidth = MOS_ALIGN_CEIL((m_width + 1) / 2, 16) * 2 + 34;
+        m_stripeSize  = 34 * m_stripeWidth + 2 * 17 * (m_stripeWidth / 2);
+
+        GenerateLumaGrain();
+        GenerateChromaGrain();
+
+        return MOS_STATUS_SUCCESS;
+    }
+
+    MOS_STATUS Av1FilmGrainCpu::InitScalingLut(const uint8_t *pointValue, const uint8_t *pointScaling,
+        uint8_t numPoints, std::vector<int16_t> &scalingLut)
+    {
+        int16_t lut[256] = {};
+
+        if (numPoints > 0)
+        {
+            for (uint32_t i = 0; i < pointValue[0]; i++)
+            {
+                lut[i] = pointScaling[0];
+            }
+
+            for (uint32_t point = 0; point < (uint32_t)numPoints - 1; point++)
+            {
+                int32_t deltaY = pointScaling[point + 1] - pointScaling[point];
+                int32_t deltaX = pointValue[point + 1] - pointValue[point];
+                if (deltaX <= 0)
+                {
+                    // Scaling points must be increasing
+                    return MOS_STATUS_INVALID_PARAMETER;
+                }
+
+                int64_t delta = (int64_t)deltaY * ((65536 + (deltaX >> 1)) / deltaX);
+                for (int32_t x = 0; x < deltaX; x++)
+                {
+                    lut[pointValue[point] + x] = pointScaling[point] + (int16_t)((x * delta + 32768) >> 16);
+                }
+            }
+
+            for (uint32_t i = pointValue[numPoints - 1]; i < 256; i++)
+            {
+                lut[i] = pointScaling[numPoints - 1];
+            }
+        }
+
+        // Expand to every sample value so blending is a plain look up for high bit depth too
+        uint32_t shift = m_bitDepth - 8;
+        scalingLut.resize(256 << shift);
+        for (uint32_t index = 0; index < scalingLut.size(); index++)
+        {
+            uint32_t x   = index >> shift;
+            uint32_t rem = index - (x << shift);
+            if (shift == 0 || x == 255)
+            {
+                scalingLut[index] = lut[x];
+            }
+            else
+            {
+                scalingLut[index] = lut[x] + (int16_t)Round2((lut[x + 1] - lut[x]) * (int32_t)rem, shift);
+            }
+        }
+
+        return MOS_STATUS_SUCCESS;
+    }
+
+    void Av1FilmGrainCpu::GenerateLumaGrain()
+    {
+        uint32_t shift          = 12 - m_bitDepth + m_params.m_filmGrainInfoFlags.m_fields.m_grainScaleShift;
+        uint16_t randomRegister = m_params.m_randomSeed;
+
+        for (uint32_t y = 0; y < m_lumaGrainH; y++)
+        {
+            for (uint32_t x = 0; x < m_lumaGrainW; x++)
+            {
+                int32_t g = 0;
+                if (m_params.m_numYPoints > 0)
+                {
+                    g = gaussianSequence[GetRandomNumber(randomRegister, 11)];
+                }
+                m_lumaGrain[y][x] = (int16_t)Round2(g, shift);
+            }
+        }
+
+        uint32_t arShift = m_params.m_filmGrainInfoFlags.m_fields.m_arCoeffShiftMinus6 + 6;
+        int32_t  lag     = m_params.m_filmGrainInfoFlags.m_fields.m_arCoeffLag;
+
+        for (uint32_t y = 3; y < m_lumaGrainH; y++)
+        {
+            for (uint32_t x = 3; x < m_lumaGrainW - 3; x++)
+            {
+                int32_t  sum = 0;
+                uint32_t pos = 0;
+                for (int32_t deltaRow = -lag; deltaRow <= 0; deltaRow++)
+                {
+                    for (int32_t deltaCol = -lag; deltaCol <= lag; deltaCol++)
+                    {
+                        if (deltaRow == 0 && deltaCol == 0)
+                        {
+                            break;
+                        }
+                        sum += m_lumaGrain[y + deltaRow][x + deltaCol] * m_params.m_arCoeffsY[pos++];
+                    }
+                }
+                m_lumaGrain[y][x] = (int16_t)MOS_CLAMP_MIN_MAX(m_lumaGrain[y][x] + Round2(sum, arShift), m_grainMin, m_grainMax);
+            }
+        }
+    }
+
+    void Av1FilmGrainCpu::GenerateChromaGrain()
+    {
+        uint32_t shift      = 12 - m_bitDepth + m_params.m_filmGrainInfoFlags.m_fields.m_grainScaleShift;
+        bool     fromLuma   = m_params.m_filmGrainInfoFlags.m_fields.m_chromaScalingFromLuma;
+        bool     cbEnabled  = (m_params.m_numCbPoints > 0) || fromLuma;
+        bool     crEnabled  = (m_params.m_numCrPoints > 0) || fromLuma;
+
+        uint16_t randomRegister = m_params.m_randomSeed ^ 0xb524;
+        for (uint32_t y = 0; y < m_chromaGrainH; y++)
+        {
+            for (uint32_t x = 0; x < m_chromaGrainW; x++)
+            {
+                int32_t g = cbEnabled ? gaussianSequence[GetRandomNumber(randomRegister, 11)] : 0;
+                m_cbGrain[y][x] = (int16_t)Round2(g, shift);
+            }
+        }
+
+        randomRegister = m_params.m_randomSeed ^ 0x49d8;
+        for (uint32_t y = 0; y < m_chromaGrainH; y++)
+        {
+            for (uint32_t x = 0; x < m_chromaGrainW; x++)
+            {
+                int32_t g = crEnabled ? gaussianSequence[GetRandomNumber(randomRegister, 11)] : 0;
+                m_crGrain[y][x] = (int16_t)Round2(g, shift);
+            }
+        }
+
+        uint32_t arShift = m_params.m_filmGrainInfoFlags.m_fields.m_arCoeffShiftMinus6 + 6;
+        int32_t  lag     = m_params.m_filmGrainInfoFlags.m_fields.m_arCoeffLag;
+
+        for (uint32_t y = 3; y < m_chromaGrainH; y++)
+        {
+            for (uint32_t x = 3; x < m_chromaGrainW - 3; x++)
+            {
+                int32_t  sum0 = 0;
+                int32_t  sum1 = 0;
+                uint32_t pos  = 0;
+                for (int32_t deltaRow = -lag; deltaRow <= 0; deltaRow++)
+                {
+                    for (int32_t deltaCol = -lag; deltaCol <= lag; deltaCol++)
+                    {
+                        int32_t c0 = m_params.m_arCoeffsCb[pos];
+                        int32_t c1 = m_params.m_arCoeffsCr[pos];
+                        if (deltaRow == 0 && deltaCol == 0)
+                        {
+                            // Average of the co-located 2x2 luma grain
+                            if (m_params.m_numYPoints > 0)
+                            {
+                                uint32_t lumaX = ((x - 3) << 1) + 3;
+                                uint32_t lumaY = ((y - 3) << 1) + 3;
+                                int32_t  luma  = m_lumaGrain[lumaY][lumaX] + m_lumaGrain[lumaY][lumaX + 1] +
+                                                m_lumaGrain[lumaY + 1][lumaX] + m_lumaGrain[lumaY + 1][lumaX + 1];
+                                luma = Round2(luma, 2);
+                                sum0 += luma * c0;
+                                sum1 += luma * c1;
+                            }
+                            break;
+                        }
+                        sum0 += c0 * m_cbGrain[y + deltaRow][x + deltaCol];
+                        sum1 += c1 * m_crGrain[y + deltaRow][x + deltaCol];
+                        pos++;
+                    }
+                }
+                if (cbEnabled)
+                {
+                    m_cbGrain[y][x] = (int16_t)MOS_CLAMP_MIN_MAX(m_cbGrain[y][x] + Round2(sum0, arShift), m_grainMin, m_grainMax);
+                }
+                if (crEnabled)
+                {
+                    m_crGrain[y][x] = (int16_t)MOS_CLAMP_MIN_MAX(m_crGrain[y][x] + Round2(sum1, arShift), m_grainMin, m_grainMax);
+                }
+            }
+        }
+    }
+
+    void Av1FilmGrainCpu::GenerateNoiseStripe(uint32_t stripeIdx, std::vector<int16_t> &stripe) const
+    {
+        stripe.resize(m_stripeSize);
+
+        uint32_t chromaStripeWidth = m_stripeWidth / 2;
+        int16_t *noiseY            = stripe.data();
+        int16_t *noiseCb           = noiseY + 34 * m_stripeWidth;
+        int16_t *noiseCr           = noiseCb + 17 * chromaStripeWidth;
+        bool     overlap           = m_params.m_filmGrainInfoFlags.m_fields.m_overlapFlag;
+
+        uint16_t randomRegister = m_params.m_randomSeed;
+        randomRegister ^= ((stripeIdx * 37 + 178) & 255) << 8;
+        randomRegister ^= ((stripeIdx * 173 + 105) & 255);
+
+        for (uint32_t x = 0; x < (m_width + 1) / 2; x += 16)
+        {
+            uint16_t rand    = GetRandomNumber(randomRegister, 8);
+            uint32_t offsetX = rand >> 4;
+            uint32_t offsetY = rand & 15;
+
+            uint32_t lumaOffsetX = 9 + offsetX * 2;
+            uint32_t lumaOffsetY = 9 + offsetY * 2;
+            for (uint32_t i = 0; i < 34; i++)
+            {
+                int16_t *row = noiseY + i * m_stripeWidth + x * 2;
+                for (uint32_t j = 0; j < 34; j++)
+                {
+                    int32_t g = m_lumaGrain[lumaOffsetY + i][lumaOffsetX + j];
+                    if (j < 2 && overlap && x > 0)
+                    {
+                        int32_t old = row[j];
+                        g = (j == 0) ? (old * 27 + g * 17) : (old * 17 + g * 27);
+                        g = MOS_CLAMP_MIN_MAX(Round2(g, 5), m_grainMin, m_grainMax);
+                    }
+                    row[j] = (int16_t)g;
+                }
+            }
+
+            uint32_t chromaOffsetX = 6 + offsetX;
+            uint32_t chromaOffsetY = 6 + offsetY;
+            for (uint32_t i = 0; i < 17; i++)
+            {
+                int16_t *rowCb = noiseCb + i * chromaStripeWidth + x;
+                int16_t *rowCr = noiseCr + i * chromaStripeWidth + x;
+                for (uint32_t j = 0; j < 17; j++)
+                {
+                    int32_t gCb = m_cbGrain[chromaOffsetY + i][chromaOffsetX + j];
+                    int32_t gCr = m_crGrain[chromaOffsetY + i][chromaOffsetX + j];
+                    if (j == 0 && overlap && x > 0)
+                    {
+                        gCb = MOS_CLAMP_MIN_MAX(Round2(rowCb[j] * 23 + gCb * 22, 5), m_grainMin, m_grainMax);
+                        gCr = MOS_CLAMP_MIN_MAX(Round2(rowCr[j] * 23 + gCr * 22, 5), m_grainMin, m_grainMax);
+                    }
+                    rowCb[j] = (int16_t)gCb;
+                    rowCr[j] = (int16_t)gCr;
+                }
+            }
+        }
+    }
+
+    template <typename T>
+    void Av1FilmGrainCpu::BlendStripe(uint32_t stripeIdx, const int16_t *curStripe, const int16_t *prevStripe,
+        const Av1FilmGrainCpuSurface &input, Av1FilmGrainCpuSurface &output) const
+    {
+        // 16 bits containers keep samples in the most significant bits
+        const uint32_t sampleShift  = (sizeof(T) == 1) ? 0 : (16 - m_bitDepth);
+        const uint32_t scalingShift = m_params.m_filmGrainInfoFlags.m_fields.m_grainScalingMinus8 + 8;
+        const int32_t  maxSample    = (1 << m_bitDepth) - 1;
+        const bool     fromLuma     = m_params.m_filmGrainInfoFlags.m_fields.m_chromaScalingFromLuma;
+        const bool     yEnabled     = m_params.m_numYPoints > 0;
+        const bool     cbEnabled    = (m_params.m_numCbPoints > 0) || fromLuma;
+        const bool     crEnabled    = (m_params.m_numCrPoints > 0) || fromLuma;
+
+        const uint32_t chromaStripeWidth = m_stripeWidth / 2;
+        const uint32_t chromaWidth       = (m_width + 1) >> 1;
+        const uint32_t chromaHeight      = (m_height + 1) >> 1;
+        const int16_t *curCb             = curStripe + 34 * m_stripeWidth;
+        const int16_t *curCr             = curCb + 17 * chromaStripeWidth;
+
+        const int32_t cbLumaMult = m_params.m_cbLumaMult - 128;
+        const int32_t cbMult     = m_params.m_cbMult - 128;
+        const int32_t cbOffset   = (m_params.m_cbOffset - 256) * (1 << (m_bitDepth - 8));
+        const int32_t crLumaMult = m_params.m_crLumaMult - 128;
+        const int32_t crMult     = m_params.m_crMult - 128;
+        const int32_t crOffset   = (m_params.m_crOffset - 256) * (1 << (m_bitDepth - 8));
+
+        // Chroma goes first, it is scaled by the luma before grain is added to it
+        uint32_t yEnd = MOS_MIN(stripeIdx * 16 + 16, chromaHeight);
+        for (uint32_t y = stripeIdx * 16; y < yEnd; y++)
+        {
+            uint32_t i     = y - stripeIdx * 16;
+            const T *inY   = (const T *)(input.y + (y << 1) * input.yPitch);
+            const T *inUv  = (const T *)(input.uv + y * input.uvPitch);
+            T       *outUv = (T *)(output.uv + y * output.uvPitch);
+
+            for (uint32_t x = 0; x < chromaWidth; x++)
+            {
+                int32_t noiseCb = curCb[i * chromaStripeWidth + x];
+                int32_t noiseCr = curCr[i * chromaStripeWidth + x];
+                if (i == 0 && prevStripe != nullptr)
+                {
+                    const int16_t *prevCb = prevStripe + 34 * m_stripeWidth;
+                    const int16_t *prevCr = prevCb + 17 * chromaStripeWidth;
+                    noiseCb = MOS_CLAMP_MIN_MAX(Round2(prevCb[16 * chromaStripeWidth + x] * 23 + noiseCb * 22, 5), m_grainMin, m_grainMax);
+                    noiseCr = MOS_CLAMP_MIN_MAX(Round2(prevCr[16 * chromaStripeWidth + x] * 23 + noiseCr * 22, 5), m_grainMin, m_grainMax);
+                }
+
+                uint32_t lumaX       = x << 1;
+                uint32_t lumaNextX   = MOS_MIN(lumaX + 1, m_width - 1);
+                int32_t  averageLuma = Round2((inY[lumaX] >> sampleShift) + (inY[lumaNextX] >> sampleShift), 1);
+                int32_t  origCb      = inUv[2 * x] >> sampleShift;
+                int32_t  origCr      = inUv[2 * x + 1] >> sampleShift;
+                int32_t  outCb       = origCb;
+                int32_t  outCr       = origCr;
+
+                if (cbEnabled)
+                {
+                    int32_t merged = fromLuma ? averageLuma :
+                        MOS_CLAMP_MIN_MAX(((averageLuma * cbLumaMult + origCb * cbMult) >> 6) + cbOffset, 0, maxSample);
+                    int32_t noise = Round2(m_scalingLut[1][merged] * noiseCb, scalingShift);
+                    outCb = MOS_CLAMP_MIN_MAX(origCb + noise, m_minValue, m_maxChroma);
+                }
+                if (crEnabled)
+                {
+                    int32_t merged = fromLuma ? averageLuma :
+                        MOS_CLAMP_MIN_MAX(((averageLuma * crLumaMult + origCr * crMult) >> 6) + crOffset, 0, maxSample);
+                    int32_t noise = Round2(m_scalingLut[2][merged] * noiseCr, scalingShift);
+                    outCr = MOS_CLAMP_MIN_MAX(origCr + noise, m_minValue, m_maxChroma);
+                }
+
+                outUv[2 * x]     = (T)(outCb << sampleShift);
+                outUv[2 * x + 1] = (T)(outCr << sampleShift);
+            }
+        }
+
+        std::vector<int16_t> overlapRow(m_width);
+        yEnd = MOS_MIN(stripeIdx * 32 + 32, m_height);
+        for (uint32_t y = stripeIdx * 32; y < yEnd; y++)
+        {
+            uint32_t       i     = y - stripeIdx * 32;
+            const T       *inY   = (const T *)(input.y + y * input.yPitch);
+            T             *outY  = (T *)(output.y + y * output.yPitch);
+            const int16_t *noise = curStripe + i * m_stripeWidth;
+
+            if (i < 2 && prevStripe != nullptr)
+            {
+                const int16_t *old = prevStripe + (i + 32) * m_stripeWidth;
+                for (uint32_t x = 0; x < m_width; x++)
+                {
+                    int32_t g     = (i == 0) ? (old[x] * 27 + noise[x] * 17) : (old[x] * 17 + noise[x] * 27);
+                    overlapRow[x] = (int16_t)MOS_CLAMP_MIN_MAX(Round2(g, 5), m_grainMin, m_grainMax);
+                }
+                noise = overlapRow.data();
+            }
+
+            for (uint32_t x = 0; x < m_width; x++)
+            {
+                int32_t orig = inY[x] >> sampleShift;
+                int32_t out  = orig;
+                if (yEnabled)
+                {
+                    out = MOS_CLAMP_MIN_MAX(orig + Round2(m_scalingLut[0][orig] * noise[x], scalingShift), m_minValue, m_maxLuma);
+                }
+                outY[x] = (T)(out << sampleShift);
+            }
+        }
+    }
+
+    MOS_STATUS Av1FilmGrainCpu::Apply(const Av1FilmGrainCpuSurface &input, Av1FilmGrainCpuSurface &output,
+        uint32_t firstStripe, uint32_t stripeNum) const
+    {
+        if (input.y == nullptr || input.uv == nullptr || output.y == nullptr || output.uv == nullptr)
+        {
+            return MOS_STATUS_NULL_POINTER;
+        }
+        if (m_stripeNum == 0 || firstStripe + stripeNum > m_stripeNum)
+        {
+            return MOS_STATUS_INVALID_PARAMETER;
+        }
+
+        bool                 overlap = m_params.m_filmGrainInfoFlags.m_fields.m_overlapFlag;
+        std::vector<int16_t> prevStripe;
+        std::vector<int16_t> curStripe;
+
+        // Stripes are seeded by their index only, regenerate the one above for the overlap
+        if (overlap && firstStripe > 0)
+        {
+            GenerateNoiseStripe(firstStripe - 1, prevStripe);
+        }
+
+        for (uint32_t stripeIdx = firstStripe; stripeIdx < firstStripe + stripeNum; stripeIdx++)
+        {
+            GenerateNoiseStripe(stripeIdx, curStripe);
+
+            const int16_t *prev = (overlap && stripeIdx > 0) ? prevStripe.data() : nullptr;
+            if (m_bitDepth == 8)
+            {
+                BlendStripe<uint8_t>(stripeIdx, curStripe.data(), prev, input, output);
+            }
+            else
+            {
+                BlendStripe<uint16_t>(stripeIdx, curStripe.data(), prev, input, output);
+            }
+
+            prevStripe.swap(curStripe);
+        }
+
+        return MOS_STATUS_SUCCESS;
+    }
+
+}  // namespace decode
@@ -0,0 +1,150 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     decode_av1_film_grain_cpu.h
+//! \brief    Defines the CPU implementation of av1 film grain synthesis
+//! \details  Follows the film grain synthesis process of the AV1 spec (7.18.3) bit
+//!           exactly, on linear 4:2:0 surfaces (NV12, P010 and P016). The frame is
+//!           processed in stripes of 32 luma rows which only depend on the grain
+//!           templates, so disjoint stripe ranges can be applied by different threads.
+//!
+#ifndef __DECODE_AV1_FILM_GRAIN_CPU_H__
+#define __DECODE_AV1_FILM_GRAIN_CPU_H__
+
+#include <vector>
+#include "codec_def_decode_av1.h"
+#include "mos_defs.h"
+
+namespace decode
+{
+    //!
+    //! \struct Av1FilmGrainCpuSurface
+    //! \brief  Linear 4:2:0 surface with interleaved chroma
+    //!
+    struct Av1FilmGrainCpuSurface
+    {
+        uint8_t  *y       = nullptr;    //!< Luma plane
+        uint8_t  *uv      = nullptr;    //!< Interleaved chroma plane
+        uint32_t  yPitch  = 0;          //!< Luma pitch in bytes
+        uint32_t  uvPitch = 0;          //!< Chroma pitch in bytes
+    };
+
+    class Av1FilmGrainCpu
+    {
+    public:
+        Av1FilmGrainCpu() {}
+        virtual ~Av1FilmGrainCpu() {}
+
+        //!
+        //! \brief  Generate grain templates and scaling look up tables for a frame
+        //! \param  [in] params
+        //!         Film grain parameters of the frame
+        //! \param  [in] bitDepth
+        //!         Bit depth of the frame, 8 for NV12, 10 or 12 for 16 bits per sample surfaces
+        //! \param  [in] width
+        //!         Frame width in luma samples
+        //! \param  [in] height
+        //!         Frame height in luma samples
+        //! \param  [in] identityMatrix
+        //!         Indicates matrix coefficients are identity, restricted range chroma is then clipped as luma
+        //! \return MOS_STATUS
+        //!         MOS_STATUS_SUCCESS if success, else fail reason
+        //!
+        MOS_STATUS Init(const CodecAv1FilmGrainParams &params, uint8_t bitDepth,
+            uint32_t width, uint32_t height, bool identityMatrix);
+
+        //!
+        //! \brief  Get number of 32 luma rows stripes of the frame
+        //! \return uint32_t
+        //!         Stripe number
+        //!
+        uint32_t GetStripeNum() const { return m_stripeNum; }
+
+        //!
+        //! \brief  Apply film grain to a range of stripes
+        //! \details Only reads the state built by Init, so calls on disjoint stripe
+        //!          ranges can run concurrently. Input and output can be the same surface.
+        //! \param  [in] input
+        //!         Decoded surface
+        //! \param  [out] output
+        //!         Film grain applied surface
+        //! \param  [in] firstStripe
+        //!         First stripe to apply
+        //! \param  [in] stripeNum
+        //!         Number of stripes to apply
+        //! \return MOS_STATUS
+        //!         MOS_STATUS_SUCCESS if success, else fail reason
+        //!
+        MOS_STATUS Apply(const Av1FilmGrainCpuSurface &input, Av1FilmGrainCpuSurface &output,
+            uint32_t firstStripe, uint32_t stripeNum) const;
+
+        //!
+        //! \brief  Apply film grain to the whole frame
+        //! \return MOS_STATUS
+        //!         MOS_STATUS_SUCCESS if success, else fail reason
+        //!
+        MOS_STATUS Apply(const Av1FilmGrainCpuSurface &input, Av1FilmGrainCpuSurface &output) const
+        {
+            return Apply(input, output, 0, m_stripeNum);
+        }
+
+    protected:
+        static constexpr uint32_t m_lumaGrainW   = 82;
+        static constexpr uint32_t m_lumaGrainH   = 73;
+        static constexpr uint32_t m_chromaGrainW = 44;
+        static constexpr uint32_t m_chromaGrainH = 38;
+        static constexpr uint32_t m_planeNum     = 3;
+
+        static uint16_t GetRandomNumber(uint16_t &randomRegister, uint32_t bits);
+
+        MOS_STATUS InitScalingLut(const uint8_t *pointValue, const uint8_t *pointScaling,
+            uint8_t numPoints, std::vector<int16_t> &scalingLut);
+        void GenerateLumaGrain();
+        void GenerateChromaGrain();
+        void GenerateNoiseStripe(uint32_t stripeIdx, std::vector<int16_t> &stripe) const;
+
+        template <typename T>
+        void BlendStripe(uint32_t stripeIdx, const int16_t *curStripe, const int16_t *prevStripe,
+            const Av1FilmGrainCpuSurface &input, Av1FilmGrainCpuSurface &output) const;
+
+        CodecAv1FilmGrainParams m_params        = {};
+        uint8_t                 m_bitDepth      = 8;
+        uint32_t                m_width         = 0;
+        uint32_t                m_height        = 0;
+        uint32_t                m_stripeNum     = 0;
+        uint32_t                m_stripeWidth   = 0;        //!< Luma samples per noise stripe row
+        uint32_t                m_stripeSize    = 0;        //!< Samples of one noise stripe for all planes
+        int32_t                 m_grainMin      = 0;
+        int32_t                 m_grainMax      = 0;
+        int32_t                 m_minValue      = 0;
+        int32_t                 m_maxLuma       = 0;
+        int32_t                 m_maxChroma     = 0;
+
+        int16_t                 m_lumaGrain[m_lumaGrainH][m_lumaGrainW]       = {};
+        int16_t                 m_cbGrain[m_chromaGrainH][m_chromaGrainW]     = {};
+        int16_t                 m_crGrain[m_chromaGrainH][m_chromaGrainW]     = {};
+        std::vector<int16_t>    m_scalingLut[m_planeNum];   //!< Scaling function per sample value at frame bit depth
+    };
+
+}  // namespace decode
+
+#endif  // !__DECODE_AV1_FILM_GRAIN_CPU_H__
@@ -0,0 +1,297 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <vector>
+#include "gtest/gtest.h"
+#include "decode_av1_film_grain_cpu.h"
+
+using namespace decode;
+
+//! Known answers were produced by a separate model written directly from the
+//! film grain synthesis process of the AV1 spec (7.18.3), run on whole noise
+//! images rather than stripes, for the parameters and input built below.
+class Av1FilmGrainCpuTest : public testing::Test
+{
+public:
+    static const uint32_t WIDTH  = 67;      // Odd sizes exercise the chroma and stripe edges
+    static const uint32_t HEIGHT = 83;      // 3 stripes of 32 luma rows
+    static const uint32_t PAD    = 32;      // Pitch padding, must be left untouched
+
+    struct Frame
+    {
+        uint8_t                bitDepth = 8;
+        std::vector<uint8_t>   y;
+        std::vector<uint8_t>   uv;
+        Av1FilmGrainCpuSurface surface;
+    };
+
+    static CodecAv1FilmGrainParams BuildParams(bool overlap)
+    {
+        static const uint8_t pointY[]       = {0, 64, 160, 255};
+        static const uint8_t scalingY[]     = {20, 48, 80, 32};
+        static const uint8_t pointCb[]      = {0, 128, 255};
+        static const uint8_t scalingCb[]    = {16, 40, 24};
+        static const uint8_t pointCr[]      = {32, 200};
+        static const uint8_t scalingCr[]    = {36, 20};
+        static const int8_t  arCoeffsY[24]  = {4, -3, 2, 0, -1, 5, -2, 3, 1, -4, 2, 6,
+                                               -3, 1, 0, 2, -5, 3, 1, -2, 4, 8, -6, 24};
+        static const int8_t  arCoeffsCb[25] = {-2, 1, 3, -1, 0, 2, -3, 4, 1, -2, 0, 3, -1,
+                                               2, 5, -4, 1, 0, 2, -3, 6, -5, 10, 20, 12};
+        static const int8_t  arCoeffsCr[25] = {1, -1, 0, 2, -2, 3, 1, -3, 0, 4, -1, 2, 1,
+                                               -2, 3, 0, -4, 2, 1, 5, -3, 7, -8, 18, -10};
+
+        CodecAv1FilmGrainParams params = {};
+        params.m_filmGrainInfoFlags.m_fields.m_applyGrain            = 1;
+        params.m_filmGrainInfoFlags.m_fields.m_grainScalingMinus8    = 3;
+        params.m_filmGrainInfoFlags.m_fields.m_arCoeffLag            = 3;
+        params.m_filmGrainInfoFlags.m_fields.m_arCoeffShiftMinus6    = 1;
+        params.m_filmGrainInfoFlags.m_fields.m_overlapFlag           = overlap ? 1 : 0;
+        params.m_filmGrainInfoFlags.m_fields.m_clipToRestrictedRange = 1;
+        params.m_randomSeed = 0x2f4b;
+
+        params.m_numYPoints  = sizeof(pointY);
+        params.m_numCbPoints = sizeof(pointCb);
+        params.m_numCrPoints = sizeof(pointCr);
+        memcpy(params.m_pointYValue, pointY, sizeof(pointY));
+        memcpy(params.m_pointYScaling, scalingY, sizeof(scalingY));
+        memcpy(params.m_pointCbValue, pointCb, sizeof(pointCb));
+        memcpy(params.m_pointCbScaling, scalingCb, sizeof(scalingCb));
+        memcpy(params.m_pointCrValue, pointCr, sizeof(pointCr));
+        memcpy(params.m_pointCrScaling, scalingCr, sizeof(scalingCr));
+        memcpy(params.m_arCoeffsY, arCoeffsY, sizeof(arCoeffsY));
+        memcpy(params.m_arCoeffsCb, arCoeffsCb, sizeof(arCoeffsCb));
+        memcpy(params.m_arCoeffsCr, arCoeffsCr, sizeof(arCoeffsCr));
+
+        params.m_cbMult     = 160;
+        params.m_cbLumaMult = 100;
+        params.m_cbOffset   = 270;
+        params.m_crMult     = 90;
+        params.m_crLumaMult = 180;
+        params.m_crOffset   = 240;
+        return params;
+    }
+
+    static uint32_t SampleSize(uint8_t bitDepth)
+    {
+        return bitDepth > 8 ? 2 : 1;
+    }
+
+    static uint32_t GetSample(const uint8_t *row, uint32_t x, uint8_t bitDepth)
+    {
+        return bitDepth > 8 ? (((const uint16_t *)row)[x] >> (16 - bitDepth)) : row[x];
+    }
+
+    static void SetSample(uint8_t *row, uint32_t x, uint8_t bitDepth, uint32_t value)
+    {
+        if (bitDepth > 8)
+        {
+            ((uint16_t *)row)[x] = (uint16_t)(value << (16 - bitDepth));
+        }
+        else
+        {
+            row[x] = (uint8_t)value;
+        }
+    }
+
+    //! Builds a NV12 or P010 frame with a deterministic pattern, padding is filled with 0xa5.
+    static void CreateFrame(Frame &frame, uint8_t bitDepth, bool fillPattern)
+    {
+        uint32_t mask        = (1 << bitDepth) - 1;
+        uint32_t yPitch      = WIDTH * SampleSize(bitDepth) + PAD;
+        uint32_t uvPitch     = ((WIDTH + 1) / 2) * 2 * SampleSize(bitDepth) + PAD;
+        uint32_t chromaWidth = (WIDTH + 1) / 2;
+        uint32_t chromaHeight = (HEIGHT + 1) / 2;
+
+        frame.bitDepth = bitDepth;
+        frame.y.assign(yPitch * HEIGHT, 0xa5);
+        frame.uv.assign(uvPitch * chromaHeight, 0xa5);
+        frame.surface.y       = frame.y.data();
+        frame.surface.uv      = frame.uv.data();
+        frame.surface.yPitch  = yPitch;
+        frame.surface.uvPitch = uvPitch;
+
+        if (!fillPattern)
+        {
+            return;
+        }
+        for (uint32_t y = 0; y < HEIGHT; y++)
+        {
+            for (uint32_t x = 0; x < WIDTH; x++)
+            {
+                SetSample(&frame.y[y * yPitch], x, bitDepth, (x * 37 + y * 101 + x * y * 3) & mask);
+            }
+        }
+        for (uint32_t y = 0; y < chromaHeight; y++)
+        {
+            for (uint32_t x = 0; x < chromaWidth; x++)
+            {
+                SetSample(&frame.uv[y * uvPitch], 2 * x, bitDepth, (x * 53 + y * 29 + 77) & mask);
+                SetSample(&frame.uv[y * uvPitch], 2 * x + 1, bitDepth, (x * 11 + y * 71 + x * y) & mask);
+            }
+        }
+    }
+
+    //! FNV-1a over the little endian 16 bits sample values of a plane.
+    static uint32_t Checksum(const std::vector<uint8_t> &plane, uint32_t pitch, uint32_t width,
+        uint32_t height, uint8_t bitDepth)
+    {
+        uint32_t hash = 2166136261u;
+        for (uint32_t y = 0; y < height; y++)
+        {
+            for (uint32_t x = 0; x < width; x++)
+            {
+                uint32_t value = GetSample(&plane[y * pitch], x, bitDepth);
+                hash = (hash ^ (value & 0xff)) * 16777619u;
+                hash = (hash ^ (value >> 8)) * 16777619u;
+            }
+        }
+        return hash;
+    }
+
+    static bool PaddingUntouched(const std::vector<uint8_t> &plane, uint32_t pitch, uint32_t rowBytes)
+    {
+        for (uint32_t offset = 0; offset < plane.size(); offset += pitch)
+        {
+            for (uint32_t x = rowBytes; x < pitch; x++)
+            {
+                if (plane[offset + x] != 0xa5)
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    void CheckKnownAnswer(uint8_t bitDepth, bool overlap, uint32_t expectedY, uint32_t expectedUv)
+    {
+        Av1FilmGrainCpu filmGrain;
+        ASSERT_EQ(MOS_STATUS_SUCCESS, filmGrain.Init(BuildParams(overlap), bitDepth, WIDTH, HEIGHT, false));
+        EXPECT_EQ(3u, filmGrain.GetStripeNum());
+
+        Frame input, output;
+        CreateFrame(input, bitDepth, true);
+        CreateFrame(output, bitDepth, false);
+        ASSERT_EQ(MOS_STATUS_SUCCESS, filmGrain.Apply(input.surface, output.surface));
+
+        uint32_t chromaWidth  = (WIDTH + 1) / 2;
+        uint32_t chromaHeight = (HEIGHT + 1) / 2;
+        EXPECT_EQ(expectedY, Checksum(output.y, output.surface.yPitch, WIDTH, HEIGHT, bitDepth));
+        EXPECT_EQ(expectedUv, Checksum(output.uv, output.surface.uvPitch, chromaWidth * 2, chromaHeight, bitDepth));
+        EXPECT_TRUE(PaddingUntouched(output.y, output.surface.yPitch, WIDTH * SampleSize(bitDepth)));
+        EXPECT_TRUE(PaddingUntouched(output.uv, output.surface.uvPitch, chromaWidth * 2 * SampleSize(bitDepth)));
+
+        // Applying in place gives the same result
+        ASSERT_EQ(MOS_STATUS_SUCCESS, filmGrain.Apply(input.surface, input.surface));
+        EXPECT_EQ(output.y, input.y);
+        EXPECT_EQ(output.uv, input.uv);
+    }
+
+    //! Every split of the stripes must match the whole frame, the stripe above a range is regenerated for overlap.
+    void CheckStripeRanges(uint8_t bitDepth, bool overlap)
+    {
+        Av1FilmGrainCpu filmGrain;
+        ASSERT_EQ(MOS_STATUS_SUCCESS, filmGrain.Init(BuildParams(overlap), bitDepth, WIDTH, HEIGHT, false));
+        uint32_t stripeNum = filmGrain.GetStripeNum();
+
+        Frame input, whole;
+        CreateFrame(input, bitDepth, true);
+        CreateFrame(whole, bitDepth, false);
+        ASSERT_EQ(MOS_STATUS_SUCCESS, filmGrain.Apply(input.surface, whole.surface));
+
+        for (uint32_t split = 1; split < stripeNum; split++)
+        {
+            Frame parts;
+            CreateFrame(parts, bitDepth, false);
+            // Bottom range first, as another thread may get there before the top one
+            ASSERT_EQ(MOS_STATUS_SUCCESS, filmGrain.Apply(input.surface, parts.surface, split, stripeNum - split));
+            ASSERT_EQ(MOS_STATUS_SUCCESS, filmGrain.Apply(input.surface, parts.surface, 0, split));
+            EXPECT_EQ(whole.y, parts.y) << "split at stripe " << split;
+            EXPECT_EQ(whole.uv, parts.uv) << "split at stripe " << split;
+        }
+
+        Frame single;
+        CreateFrame(single, bitDepth, false);
+        for (uint32_t stripe = 0; stripe < stripeNum; stripe++)
+        {
+            ASSERT_EQ(MOS_STATUS_SUCCESS, filmGrain.Apply(input.surface, single.surface, stripe, 1));
+        }
+        EXPECT_EQ(whole.y, single.y);
+        EXPECT_EQ(whole.uv, single.uv);
+    }
+};
+
+TEST_F(Av1FilmGrainCpuTest, KnownAnswer8BitOverlap)
+{
+    CheckKnownAnswer(8, true, 0x49dfd272, 0xcb52ac53);
+}
+
+TEST_F(Av1FilmGrainCpuTest, KnownAnswer8BitNoOverlap)
+{
+    CheckKnownAnswer(8, false, 0x9065965d, 0x9874b83b);
+}
+
+TEST_F(Av1FilmGrainCpuTest, KnownAnswer10BitOverlap)
+{
+    CheckKnownAnswer(10, true, 0x7245a8e9, 0x2dd8d92d);
+}
+
+TEST_F(Av1FilmGrainCpuTest, KnownAnswer10BitNoOverlap)
+{
+    CheckKnownAnswer(10, false, 0xffdf71c3, 0xddbd0196);
+}
+
+TEST_F(Av1FilmGrainCpuTest, StripeRangesMatchWholeFrame)
+{
+    CheckStripeRanges(8, true);
+    CheckStripeRanges(8, false);
+    CheckStripeRanges(10, true);
+    CheckStripeRanges(10, false);
+}
+
+TEST_F(Av1FilmGrainCpuTest, InvalidParameters)
+{
+    Av1FilmGrainCpu         filmGrain;
+    CodecAv1FilmGrainParams params = BuildParams(true);
+
+    EXPECT_NE(MOS_STATUS_SUCCESS, filmGrain.Init(params, 9, WIDTH, HEIGHT, false));
+    EXPECT_NE(MOS_STATUS_SUCCESS, filmGrain.Init(params, 8, 0, HEIGHT, false));
+    EXPECT_NE(MOS_STATUS_SUCCESS, filmGrain.Init(params, 8, WIDTH, 0, false));
+
+    params.m_numYPoints = 15;
+    EXPECT_NE(MOS_STATUS_SUCCESS, filmGrain.Init(params, 8, WIDTH, HEIGHT, false));
+
+    // Scaling points must be increasing
+    params = BuildParams(true);
+    params.m_pointCbValue[1] = params.m_pointCbValue[0];
+    EXPECT_NE(MOS_STATUS_SUCCESS, filmGrain.Init(params, 8, WIDTH, HEIGHT, false));
+
+    Frame frame;
+    CreateFrame(frame, 8, true);
+    Av1FilmGrainCpu uninitialized;
+    EXPECT_NE(MOS_STATUS_SUCCESS, uninitialized.Apply(frame.surface, frame.surface));
+
+    ASSERT_EQ(MOS_STATUS_SUCCESS, filmGrain.Init(BuildParams(true), 8, WIDTH, HEIGHT, false));
+    EXPECT_NE(MOS_STATUS_SUCCESS, filmGrain.Apply(frame.surface, frame.surface, 2, 2));
+    Av1FilmGrainCpuSurface empty;
+    EXPECT_NE(MOS_STATUS_SUCCESS, filmGrain.Apply(frame.surface, empty));
+}
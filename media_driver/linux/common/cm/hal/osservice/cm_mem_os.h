@@ -137,4 +137,42 @@ inline void GetCPUID(int cpuInfo[4], int infoType)
 #endif  //NO_EXCEPTION_HANDLING
 }
 
+/*****************************************************************************\
+Inline Function:
+    GetCPUIDEx
+
+Description:
+    Retrieves cpu information for leaves that take a sub-leaf index
+Input:
+    int infoType - type of information requested
+    int subLeaf - sub-leaf index of the requested leaf
+Output:
+    int cpuInfo[4] - requested info, zero if the leaf is not supported
+\*****************************************************************************/
+inline void GetCPUIDEx(int cpuInfo[4], int infoType, int subLeaf)
+{
+    if (!__get_cpuid_count(infoType, subLeaf, (unsigned int*)cpuInfo, (unsigned int*)cpuInfo + 1, (unsigned int*)cpuInfo + 2, (unsigned int*)cpuInfo + 3))
+    {
+        memset(cpuInfo, 0, 4 * sizeof(int));
+    }
+}
+
+/*****************************************************************************\
+Inline Function:
+    GetXCR0
+
+Description:
+    Reads the XCR0 register to find which register states the OS saves.
+    Must only be called when CPUID reports OSXSAVE.
+Output:
+    uint64_t - value of XCR0
+\*****************************************************************************/
+inline uint64_t GetXCR0( void )
+{
+    uint32_t eax = 0;
+    uint32_t edx = 0;
+    __asm__ __volatile__ ("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return ((uint64_t)edx << 32) | eax;
+}
+
 void CmFastMemCopyFromWC( void* dst, const void* src, const size_t bytes, CPU_INSTRUCTION_LEVEL cpuInstructionLevel );
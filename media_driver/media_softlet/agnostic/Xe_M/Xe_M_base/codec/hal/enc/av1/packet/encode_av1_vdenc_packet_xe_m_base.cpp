@@ -401,9 +401,9 @@ namespace encode
                 cmdBuffer,
                 m_osInterface->pOsContext,
                 &tempCmdBuffer->OsResource,
-                0,
+                tileLevelBatchBuffer->dwOffset,
                 false,
-                tempCmdBuffer->iOffset);
+                tempCmdBuffer->iOffset - tileLevelBatchBuffer->dwOffset);
             HalOcaInterfaceNext::On1stLevelBBEnd(*tempCmdBuffer, *m_osInterface);
         }
 
@@ -420,8 +420,15 @@ namespace encode
         CodechalDebugInterface* debugInterface = m_pipeline->GetDebugInterface();
         ENCODE_CHK_NULL_RETURN(debugInterface);
 
+        // The tile level batch buffer is a slice of an allocation shared by all tiles
+        MOS_COMMAND_BUFFER tileBatchBuf = constructTileBatchBuf;
+        if (tileLevelBatchBuffer)
+        {
+            tileBatchBuf.pCmdBase += tileLevelBatchBuffer->dwOffset / sizeof(uint32_t);
+            tileBatchBuf.iOffset -= tileLevelBatchBuffer->dwOffset;
+        }
         ENCODE_CHK_STATUS_RETURN(debugInterface->DumpCmdBuffer(
-            &constructTileBatchBuf,
+            &tileBatchBuf,
             CODECHAL_NUM_MEDIA_STATES,
             name.c_str()));
 #endif
@@ -246,6 +246,8 @@ set_source_files_properties(${CP_SOURCES_} PROPERTIES LANGUAGE "CXX")
 set_source_files_properties(${SOFTLET_DDI_SOURCES_} PROPERTIES LANGUAGE "CXX")
 set_source_files_properties(${SOURCES_SSE2} PROPERTIES LANGUAGE "CXX")
 set_source_files_properties(${SOURCES_SSE4} PROPERTIES LANGUAGE "CXX")
+set_source_files_properties(${SOURCES_AVX2} PROPERTIES LANGUAGE "CXX")
+set_source_files_properties(${SOURCES_AVX512} PROPERTIES LANGUAGE "CXX")
 
 # MHW settings
 set(SOFTLET_MHW_PRIVATE_INCLUDE_DIRS_
@@ -421,6 +423,14 @@ add_library(${LIB_NAME}_SSE4 OBJECT ${SOURCES_SSE4})
 target_compile_options(${LIB_NAME}_SSE4 PRIVATE -msse4.1)
 target_include_directories(${LIB_NAME}_SSE4 BEFORE PRIVATE ${SOFTLET_MOS_PREPEND_INCLUDE_DIRS_} ${MOS_PUBLIC_INCLUDE_DIRS_} ${SOFTLET_MOS_PUBLIC_INCLUDE_DIRS_} ${COMMON_PRIVATE_INCLUDE_DIRS_} ${SOFTLET_MHW_PRIVATE_INCLUDE_DIRS_} ${SOFTLET_DDI_PUBLIC_INCLUDE_DIRS_})
 
+add_library(${LIB_NAME}_AVX2 OBJECT ${SOURCES_AVX2})
+target_compile_options(${LIB_NAME}_AVX2 PRIVATE -mavx2)
+target_include_directories(${LIB_NAME}_AVX2 BEFORE PRIVATE ${SOFTLET_MOS_PREPEND_INCLUDE_DIRS_} ${MOS_PUBLIC_INCLUDE_DIRS_} ${SOFTLET_MOS_PUBLIC_INCLUDE_DIRS_} ${COMMON_PRIVATE_INCLUDE_DIRS_} ${SOFTLET_MHW_PRIVATE_INCLUDE_DIRS_} ${SOFTLET_DDI_PUBLIC_INCLUDE_DIRS_})
+
+add_library(${LIB_NAME}_AVX512 OBJECT ${SOURCES_AVX512})
+target_compile_options(${LIB_NAME}_AVX512 PRIVATE -mavx512f)
+target_include_directories(${LIB_NAME}_AVX512 BEFORE PRIVATE ${SOFTLET_MOS_PREPEND_INCLUDE_DIRS_} ${MOS_PUBLIC_INCLUDE_DIRS_} ${SOFTLET_MOS_PUBLIC_INCLUDE_DIRS_} ${COMMON_PRIVATE_INCLUDE_DIRS_} ${SOFTLET_MHW_PRIVATE_INCLUDE_DIRS_} ${SOFTLET_DDI_PUBLIC_INCLUDE_DIRS_})
+
 add_library(${LIB_NAME}_COMMON OBJECT ${COMMON_SOURCES_} ${SOFTLET_DDI_SOURCES_})
 set_property(TARGET ${LIB_NAME}_COMMON PROPERTY POSITION_INDEPENDENT_CODE 1)
 MediaAddCommonTargetDefines(${LIB_NAME}_COMMON)
@@ -603,6 +613,8 @@ add_library(${LIB_NAME} SHARED
     $<TARGET_OBJECTS:${LIB_NAME}_CP>
     $<TARGET_OBJECTS:${LIB_NAME}_SSE2>
     $<TARGET_OBJECTS:${LIB_NAME}_SSE4>
+    $<TARGET_OBJECTS:${LIB_NAME}_AVX2>
+    $<TARGET_OBJECTS:${LIB_NAME}_AVX512>
     $<TARGET_OBJECTS:${LIB_NAME}_SOFTLET_VP>
     $<TARGET_OBJECTS:${LIB_NAME}_SOFTLET_CODEC>
     $<TARGET_OBJECTS:${LIB_NAME}_SOFTLET_COMMON>)
@@ -616,6 +628,8 @@ add_library(${LIB_NAME_STATIC} STATIC
     $<TARGET_OBJECTS:${LIB_NAME}_CP>
     $<TARGET_OBJECTS:${LIB_NAME}_SSE2>
     $<TARGET_OBJECTS:${LIB_NAME}_SSE4>
+    $<TARGET_OBJECTS:${LIB_NAME}_AVX2>
+    $<TARGET_OBJECTS:${LIB_NAME}_AVX512>
     $<TARGET_OBJECTS:${LIB_NAME}_SOFTLET_VP>
     $<TARGET_OBJECTS:${LIB_NAME}_SOFTLET_CODEC>
     $<TARGET_OBJECTS:${LIB_NAME}_SOFTLET_COMMON>)
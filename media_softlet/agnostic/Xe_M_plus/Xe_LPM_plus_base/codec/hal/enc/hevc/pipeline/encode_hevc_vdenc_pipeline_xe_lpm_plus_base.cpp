@@ -223,6 +223,7 @@ MOS_STATUS HevcVdencPipelineXe_Lpm_Plus_Base::ActivateVdencVideoPackets()
             m_activePacketList.back().immediateSubmit = true;
             return MOS_STATUS_SUCCESS;
         }
+        SetPreEncSubmitAhead();
     }
 
     if (brcFeature->IsBRCInitRequired())
@@ -454,8 +454,12 @@ MOS_STATUS Vp9DynamicScalPktXe_Lpm_Plus_Base::AddOneTileCommands(MOS_COMMAND_BUF
         tileLevelBatchName += ("_" + std::to_string((uint32_t)m_pipeline->GetCurrentPipe()));
         tileLevelBatchName += ("_r" + std::to_string(tileRow) + "_c" + std::to_string(tileCol));
 
+        // The tile level batch buffer is a slice of an allocation shared by all tiles
+        MOS_COMMAND_BUFFER tileBatchBuf = constructTileBatchBuf;
+        tileBatchBuf.pCmdBase += tileLevelBatchBuffer->dwOffset / sizeof(uint32_t);
+        tileBatchBuf.iOffset -= tileLevelBatchBuffer->dwOffset;
         ENCODE_CHK_STATUS_RETURN(debugInterface->DumpCmdBuffer(
-            &constructTileBatchBuf,
+            &tileBatchBuf,
             CODECHAL_NUM_MEDIA_STATES,
             tileLevelBatchName.c_str()));)
 
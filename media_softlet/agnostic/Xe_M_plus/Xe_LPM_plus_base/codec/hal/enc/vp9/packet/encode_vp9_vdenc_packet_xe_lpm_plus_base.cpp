@@ -436,8 +436,12 @@ MOS_STATUS Vp9VdencPktXe_Lpm_Plus_Base::AddOneTileCommands(MOS_COMMAND_BUFFER &c
         tileLevelBatchName += ("_" + std::to_string((uint32_t)m_pipeline->GetCurrentPipe()));
         tileLevelBatchName += ("_r" + std::to_string(tileRow) + "_c" + std::to_string(tileCol));
 
+        // The tile level batch buffer is a slice of an allocation shared by all tiles
+        MOS_COMMAND_BUFFER tileBatchBuf = constructTileBatchBuf;
+        tileBatchBuf.pCmdBase += tileLevelBatchBuffer->dwOffset / sizeof(uint32_t);
+        tileBatchBuf.iOffset -= tileLevelBatchBuffer->dwOffset;
         ENCODE_CHK_STATUS_RETURN(debugInterface->DumpCmdBuffer(
-            &constructTileBatchBuf,
+            &tileBatchBuf,
             CODECHAL_NUM_MEDIA_STATES,
             tileLevelBatchName.c_str()));)
 
@@ -507,6 +511,8 @@ MOS_STATUS Vp9VdencPktXe_Lpm_Plus_Base::PatchTileLevelCommands(MOS_COMMAND_BUFFE
     uint16_t numTileRows    = 1;
     RUN_FEATURE_INTERFACE_RETURN(Vp9EncodeTile, Vp9FeatureIDs::encodeTile, GetTileRowColumns, numTileRows, numTileColumns);
 
+    RUN_FEATURE_INTERFACE_RETURN(Vp9EncodeTile, Vp9FeatureIDs::encodeTile, BeginPatchTileLevelBatchPool, m_pipeline->GetCurrentPass());
+
     for (uint32_t tileRow = 0; tileRow < numTileRows; ++tileRow)
     {
         uint32_t rowPass = m_pipeline->GetCurrentPass();
@@ -516,6 +522,8 @@ MOS_STATUS Vp9VdencPktXe_Lpm_Plus_Base::PatchTileLevelCommands(MOS_COMMAND_BUFFE
         }
     }
 
+    RUN_FEATURE_INTERFACE_RETURN(Vp9EncodeTile, Vp9FeatureIDs::encodeTile, EndPatchTileLevelBatchPool);
+
     ENCODE_CHK_STATUS_RETURN(AddVdControlMemoryImplicitFlush(cmdBuffer));
 
     m_flushCmd = waitVp9;
@@ -168,6 +168,29 @@ MOS_STATUS MediaCopyStateXe_Lpm_Plus_Base::MediaVeboxCopy(PMOS_RESOURCE src, PMO
     }
 }
 
+bool MediaCopyStateXe_Lpm_Plus_Base::IsCopyTimestampSupported()
+{
+    return true;
+}
+
+bool MediaCopyStateXe_Lpm_Plus_Base::SetCopyTimestamp(MCPY_ENGINE mcpyEngine, PMOS_RESOURCE resource, uint32_t startOffset, uint32_t endOffset)
+{
+    if (mcpyEngine == MCPY_ENGINE_BLT && m_bltState != nullptr)
+    {
+        m_bltState->SetTimestampTarget(resource, startOffset, endOffset);
+        return true;
+    }
+    else if (mcpyEngine == MCPY_ENGINE_VEBOX && m_veboxCopyState != nullptr)
+    {
+        m_veboxCopyState->SetTimestampTarget(resource, startOffset, endOffset);
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
 MOS_STATUS MediaCopyStateXe_Lpm_Plus_Base::MediaRenderCopy(PMOS_RESOURCE src, PMOS_RESOURCE dst)
 {
     // implementation
@@ -148,6 +148,28 @@ protected:
     //!
     virtual MOS_STATUS CopyEnigneSelect(MCPY_METHOD &preferMethod, MCPY_ENGINE &mcpyEngine, MCPY_ENGINE_CAPS &caps);
 
+    //!
+    //! \brief    copy timestamp support.
+    //! \return   bool
+    //!           Return true if support, otherwise return false.
+    //!
+    virtual bool IsCopyTimestampSupported();
+
+    //!
+    //! \brief    set where the next copy on an engine writes its GPU timestamps.
+    //! \param    mcpyEngine
+    //!           [in] copy engine
+    //! \param    resource
+    //!           [in] Pointer to timestamp buffer, nullptr stops writing timestamps
+    //! \param    startOffset
+    //!           [in] offset of start timestamp
+    //! \param    endOffset
+    //!           [in] offset of end timestamp
+    //! \return   bool
+    //!           Return true if the engine copy writes the timestamps, otherwise return false.
+    //!
+    virtual bool SetCopyTimestamp(MCPY_ENGINE mcpyEngine, PMOS_RESOURCE resource, uint32_t startOffset, uint32_t endOffset);
+
     MhwInterfacesNext                  *m_mhwInterfaces  = nullptr;
     RenderCopyXe_LPM_Plus_Base         *m_renderCopy     = nullptr;
     BltStateXe_Lpm_Plus_Base           *m_bltState       = nullptr;
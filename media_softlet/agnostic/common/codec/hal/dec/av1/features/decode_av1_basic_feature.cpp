@@ -865,6 +865,30 @@ namespace decode
         return MOS_STATUS_SUCCESS;
     }
 
+    const uint16_t *Av1BasicFeature::GetDefaultFrameContext(uint8_t index)
+    {
+        DECODE_FUNC_CALL();
+
+        static uint16_t       defaultCtx[av1DefaultCdfTableNum][m_cdfMaxNumBytes / sizeof(uint16_t)] = {};
+        static MOS_STATUS     initStatus = MOS_STATUS_UNKNOWN;
+        static std::once_flag initFlag;
+
+        std::call_once(initFlag, [this]() {
+            initStatus = MOS_STATUS_SUCCESS;
+            for (uint8_t i = 0; i < av1DefaultCdfTableNum && initStatus == MOS_STATUS_SUCCESS; i++)
+            {
+                initStatus = InitDefaultFrameContextBuffer(defaultCtx[i], i);
+            }
+        });
+
+        if (initStatus != MOS_STATUS_SUCCESS || index >= av1DefaultCdfTableNum)
+        {
+            return nullptr;
+        }
+
+        return defaultCtx[index];
+    }
+
     MOS_STATUS Av1BasicFeature :: UpdateDefaultCdfTable()
     {
         DECODE_FUNC_CALL();
@@ -882,7 +906,9 @@ namespace decode
                 DECODE_CHK_NULL(data);
 
                 // reset all CDF tables to default values
-                DECODE_CHK_STATUS(InitDefaultFrameContextBuffer(data, index));
+                const uint16_t *defaultCtx = GetDefaultFrameContext(index);
+                DECODE_CHK_NULL(defaultCtx);
+                DECODE_CHK_STATUS(MOS_SecureMemcpy(data, m_cdfMaxNumBytes, defaultCtx, m_cdfMaxNumBytes));
             }
 
             m_defaultFcInitialized = true;//set only once, won't set again
@@ -104,6 +104,17 @@ namespace decode
             uint16_t                    *ctxBuffer,
             SyntaxElementCdfTableLayout SyntaxElement);
 
+        //!
+        //! \brief    Get AV1 default frame context in hardware layout
+        //! \details  Default tables only depend on coeff CDF table index, so they are
+        //!           built once per process and shared by all decoder instances
+        //! \param    [in] index
+        //!           flag to indicate the coeff CDF table index
+        //! \return   const uint16_t *
+        //!           Pointer to default frame context, nullptr if fail
+        //!
+        const uint16_t *GetDefaultFrameContext(uint8_t index);
+
         //!
         //! \brief    Update default cdfTable buffers
         //! \details  Update default cdfTable buffers for AV1 decoder
@@ -27,6 +27,7 @@
 #include "decode_avc_basic_feature.h"
 #include "decode_utils.h"
 #include "decode_allocator.h"
+#include "decode_resource_auto_lock.h"
 
 namespace decode {
 
@@ -51,6 +52,10 @@ namespace decode {
         DECODE_CHK_NULL(codecSettings);
         m_shortFormatInUse = codecSettings->shortFormatInUse;
 
+        DECODE_CHK_NULL(m_osInterface);
+        m_bitstreamScanEnabled = ReadUserFeature(m_osInterface->pfnGetUserSettingInstance(m_osInterface),
+            "Decode Bitstream Scan", MediaUserSetting::Group::Sequence).Get<bool>();
+
         DECODE_CHK_STATUS(m_refFrames.Init(this, *m_allocator));
         DECODE_CHK_STATUS(m_mvBuffers.Init(m_hwInterface, *m_allocator, *this, CODEC_AVC_NUM_INIT_DMV_BUFFERS));
 
@@ -376,6 +381,8 @@ namespace decode {
             m_sliceRecord.resize(m_numSlices, {0, 0, 0});
         }
 
+        DECODE_CHK_STATUS(ScanSliceData());
+
         for (uint32_t slcCount = 0; slcCount < m_numSlices; slcCount++)
         {
             //For DECE clear bytes calculation: Total bytes in the bit-stream consumed so far
@@ -388,6 +395,7 @@ namespace decode {
 
             if (m_sliceRecord[slcCount].skip)
             {
+                slc++;
                 continue;
             }
 
@@ -451,6 +459,97 @@ namespace decode {
         return MOS_STATUS_SUCCESS;
     }
 
+    MOS_STATUS AvcBasicFeature::ScanSliceData()
+    {
+        DECODE_FUNC_CALL();
+
+        // Encrypted slice data can't be parsed on CPU
+        if (!m_bitstreamScanEnabled ||
+            (m_osInterface->osCpInterface != nullptr && m_osInterface->osCpInterface->IsCpEnabled()))
+        {
+            return MOS_STATUS_SUCCESS;
+        }
+
+        ResourceAutoLock resLock(m_allocator, &m_resDataBuffer.OsResource);
+        const uint8_t *bitstream = (const uint8_t *)resLock.LockResourceForRead();
+        if (bitstream == nullptr)
+        {
+            DECODE_NORMALMESSAGE("Bitstream buffer is not lockable, skip slice data scan");
+            return MOS_STATUS_SUCCESS;
+        }
+        bitstream += m_dataOffset;
+
+        PCODEC_AVC_SLICE_PARAMS slc = m_avcSliceParams;
+        for (uint32_t slcCount = 0; slcCount < m_numSlices; slcCount++, slc++)
+        {
+            // Slice out of bitstream buffer is handled by SetSliceStructs
+            if (((uint64_t)(slc->slice_data_offset) + slc->slice_data_size) > m_dataSize)
+            {
+                continue;
+            }
+
+            if (!IsSliceNalUnitComplete(bitstream + slc->slice_data_offset, slc->slice_data_size))
+            {
+                DECODE_ASSERTMESSAGE("Slice %d is broken, skip it", slcCount);
+                m_sliceRecord[slcCount].skip = true;
+            }
+        }
+
+        return MOS_STATUS_SUCCESS;
+    }
+
+    bool AvcBasicFeature::IsSliceNalUnitComplete(const uint8_t *data, uint32_t size)
+    {
+        uint32_t pos = 0;
+
+        // Skip start code if application keeps it in slice data
+        while (pos < size && data[pos] == 0)
+        {
+            pos++;
+        }
+        if (pos > 0)
+        {
+            if (pos < 2 || pos >= size || data[pos] != 1)
+            {
+                return false;
+            }
+            pos++;
+        }
+
+        if (pos >= size)
+        {
+            return false;
+        }
+
+        // forbidden_zero_bit must be 0, nal_unit_type must be a coded slice
+        uint8_t nalUnitHeader = data[pos];
+        uint8_t nalUnitType   = nalUnitHeader & 0x1f;
+        if ((nalUnitHeader & 0x80) || (nalUnitType != 1 && nalUnitType != 5 && nalUnitType != 20))
+        {
+            return false;
+        }
+
+        // memchr is vectorized by the C library, look for the 0x01 of a 00 00 01 prefix
+        // and only then check the preceding bytes.
+        const uint8_t *cur = data + pos + 1;
+        const uint8_t *end = data + size;
+        while (end - cur >= 3)
+        {
+            const uint8_t *one = (const uint8_t *)memchr(cur + 2, 0x01, end - cur - 2);
+            if (one == nullptr)
+            {
+                break;
+            }
+            if (one[-1] == 0 && one[-2] == 0)
+            {
+                return false;
+            }
+            cur = one - 1;
+        }
+
+        return true;
+    }
+
     MOS_STATUS AvcBasicFeature::CheckBitDepthAndChromaSampling()
     {
         DECODE_FUNC_CALL();
@@ -160,6 +160,7 @@ public:
     uint32_t                        m_slcLength               = 0;
     uint32_t                        m_slcOffset               = 0;
     bool                            m_usingVeRing             = false;
+    bool                            m_bitstreamScanEnabled    = false;        //!< Indicate slice data is scanned on CPU before submission
     // CencDecode buffer
     CencDecodeShareBuf              *m_cencBuf                = nullptr;
 
@@ -174,6 +175,27 @@ protected:
     MOS_STATUS SetSliceStructs();
     virtual MOS_STATUS CheckBitDepthAndChromaSampling();
 
+    //!
+    //! \brief  Scan slice data of current frame and mark broken slices to be skipped
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS ScanSliceData();
+
+    //!
+    //! \brief  Check if a slice NAL unit is complete
+    //! \details A start code prefix never shows up inside a complete NAL unit because of
+    //!          emulation prevention, so finding one means the slice was cut short and
+    //!          the next NAL unit follows.
+    //! \param  [in] data
+    //!         Slice data, with or without leading start code
+    //! \param  [in] size
+    //!         Size of slice data
+    //! \return bool
+    //!         true if the NAL unit header is a slice and no start code is found in the payload
+    //!
+    static bool IsSliceNalUnitComplete(const uint8_t *data, uint32_t size);
+
     PMOS_INTERFACE        m_osInterface  = nullptr;
 
 MEDIA_CLASS_DEFINE_END(decode__AvcBasicFeature)
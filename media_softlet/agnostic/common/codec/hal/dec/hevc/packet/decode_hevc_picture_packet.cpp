@@ -121,6 +121,8 @@ namespace decode
         DECODE_CHK_STATUS(SetRowstoreCachingOffsets());
         DECODE_CHK_STATUS(AllocateVariableResources());
 
+        m_refSurfaceChecked = false;
+
         return MOS_STATUS_SUCCESS;
     }
 
@@ -700,12 +702,17 @@ namespace decode
                 params.presColMvTempBuffer[i] = mvBuf ? (&mvBuf->OsResource) : nullptr;
 
                 // Return error if reference surface's pitch * height is less than dest surface.
-                MOS_SURFACE refSurface;
-                refSurface.OsResource = *(params.presReferences[i]);
-                DECODE_CHK_STATUS(m_allocator->GetSurfaceInfo(&refSurface));
-                DECODE_CHK_COND((refSurface.dwPitch * refSurface.dwHeight) < (destSurface->dwPitch * destSurface->dwHeight),
-                    "Reference surface's pitch * height is less than Dest surface.");
+                // References do not change between pipes and passes of one frame, so only check them once.
+                if (!m_refSurfaceChecked)
+                {
+                    MOS_SURFACE refSurface;
+                    refSurface.OsResource = *(params.presReferences[i]);
+                    DECODE_CHK_STATUS(m_allocator->GetSurfaceInfo(&refSurface));
+                    DECODE_CHK_COND((refSurface.dwPitch * refSurface.dwHeight) < (destSurface->dwPitch * destSurface->dwHeight),
+                        "Reference surface's pitch * height is less than Dest surface.");
+                }
             }
+            m_refSurfaceChecked = true;
         }
 
         FixHcpPipeBufAddrParams(params);
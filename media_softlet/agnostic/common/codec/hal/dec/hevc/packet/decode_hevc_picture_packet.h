@@ -177,6 +177,7 @@ protected:
     PMOS_BUFFER m_resCABACStreamOutSizeBuffer                    = nullptr; //!< Handle of CABAC stream out size buffer
 
     mutable uint8_t m_curHcpSurfStateId = 0;
+    mutable bool    m_refSurfaceChecked = false;  //!< Reference surface sizes are validated for current frame
 
 MEDIA_CLASS_DEFINE_END(decode__HevcDecodePicPkt)
 }; // class HevcDecodePicPkt
@@ -26,6 +26,7 @@
 //!
 #include "decode_jpeg_input_bitstream.h"
 #include "decode_pipeline.h"
+#include "decode_resource_auto_lock.h"
 
 namespace decode
 {
@@ -34,12 +35,25 @@ DecodeJpegInputBitstream::DecodeJpegInputBitstream(DecodePipeline* pipeline, Med
 {
 }
 
+DecodeJpegInputBitstream::~DecodeJpegInputBitstream()
+{
+    if (m_allocator)
+    {
+        m_allocator->Destroy(m_cpuCatenatedBufArray);
+    }
+}
+
 MOS_STATUS DecodeJpegInputBitstream::Init(CodechalSetting &settings)
 {
     DecodeInputBitstream::Init(settings);
 
     m_jpegBasicFeature = dynamic_cast<JpegBasicFeature *>(m_basicFeature);
     DECODE_CHK_NULL(m_jpegBasicFeature);
+
+    CodechalHwInterfaceNext *hwInterface = m_pipeline->GetHwInterface();
+    DECODE_CHK_NULL(hwInterface);
+    m_osInterface = hwInterface->GetOsInterface();
+    DECODE_CHK_NULL(m_osInterface);
     return MOS_STATUS_SUCCESS;
 }
 
@@ -57,6 +71,7 @@ MOS_STATUS DecodeJpegInputBitstream::Append(const CodechalDecodeParams &decodePa
     uint32_t segmentSize   = decodeParams.m_dataSize;
     if (firstExecuteCall)
     {
+        m_cpuCatenation = false;
         auto headerSize = m_jpegBasicFeature->m_jpegScanParams->ScanHeader[numScans - 1].DataOffset +
                           m_jpegBasicFeature->m_jpegScanParams->ScanHeader[numScans - 1].DataLength;
        
@@ -75,13 +90,23 @@ MOS_STATUS DecodeJpegInputBitstream::Append(const CodechalDecodeParams &decodePa
             m_completeBitStream = false;
             m_completeJpegScan  = true;
             m_requiredSize      = maxBufferSize;
-            
-            //Allocate Buffer
-            DECODE_CHK_STATUS(AllocateCatenatedBuffer());
-            m_basicFeature->m_resDataBuffer = *m_catenatedBuffer;
-            m_basicFeature->m_dataOffset    = 0;
-            DECODE_CHK_STATUS(ActivatePacket(DecodePacketId(m_pipeline, hucCopyPacketId), true, 0, 0));
-            AddNewSegment(*(decodeParams.m_dataBuffer), decodeParams.m_dataOffset, decodeParams.m_dataSize);
+
+            DECODE_CHK_STATUS(BeginCpuCatenation(decodeParams));
+            if (m_cpuCatenation)
+            {
+                m_basicFeature->m_resDataBuffer = *m_cpuCatenatedBuf;
+                m_basicFeature->m_dataOffset    = 0;
+                DECODE_CHK_STATUS(CpuCopySegment(decodeParams));
+            }
+            else
+            {
+                //Allocate Buffer
+                DECODE_CHK_STATUS(AllocateCatenatedBuffer());
+                m_basicFeature->m_resDataBuffer = *m_catenatedBuffer;
+                m_basicFeature->m_dataOffset    = 0;
+                DECODE_CHK_STATUS(ActivatePacket(DecodePacketId(m_pipeline, hucCopyPacketId), true, 0, 0));
+                AddNewSegment(*(decodeParams.m_dataBuffer), decodeParams.m_dataOffset, decodeParams.m_dataSize);
+            }
         }
         else
         {
@@ -102,8 +127,15 @@ MOS_STATUS DecodeJpegInputBitstream::Append(const CodechalDecodeParams &decodePa
                 DECODE_ASSERTMESSAGE("Bitstream size exceeds allocated buffer size!");
                 return MOS_STATUS_INVALID_PARAMETER;
             }
-            DECODE_CHK_STATUS(ActivatePacket(DecodePacketId(m_pipeline, hucCopyPacketId), true, 0, 0));
-            AddNewSegment(*(decodeParams.m_dataBuffer), decodeParams.m_dataOffset, decodeParams.m_dataSize);
+            if (m_cpuCatenation)
+            {
+                DECODE_CHK_STATUS(CpuCopySegment(decodeParams));
+            }
+            else
+            {
+                DECODE_CHK_STATUS(ActivatePacket(DecodePacketId(m_pipeline, hucCopyPacketId), true, 0, 0));
+                AddNewSegment(*(decodeParams.m_dataBuffer), decodeParams.m_dataOffset, decodeParams.m_dataSize);
+            }
 
             uint32_t totalSize = m_jpegBasicFeature->m_jpegScanParams->ScanHeader[totalScans - 1].DataOffset +
                                  m_jpegBasicFeature->m_jpegScanParams->ScanHeader[totalScans - 1].DataLength;
@@ -117,6 +149,68 @@ MOS_STATUS DecodeJpegInputBitstream::Append(const CodechalDecodeParams &decodePa
     return MOS_STATUS_SUCCESS;
 }
 
+MOS_STATUS DecodeJpegInputBitstream::BeginCpuCatenation(const CodechalDecodeParams &decodeParams)
+{
+    DECODE_FUNC_CALL();
+
+    m_cpuCatenation = false;
+
+    // Large pictures and protected bitstream stay on HuC copy
+    if (m_requiredSize > m_cpuCatenateMaxSize ||
+        (m_osInterface->osCpInterface != nullptr && m_osInterface->osCpInterface->IsCpEnabled()))
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
+    uint32_t allocSize = MOS_ALIGN_CEIL(m_requiredSize, MHW_CACHELINE_SIZE);
+    if (m_cpuCatenatedBufArray == nullptr)
+    {
+        m_cpuCatenatedBufArray = m_allocator->AllocateBufferArray(
+            allocSize, "bitstream", m_cpuCatenatedBufNum, resourceInputBitstream, lockableVideoMem);
+        DECODE_CHK_NULL(m_cpuCatenatedBufArray);
+    }
+
+    PMOS_BUFFER &buffer = m_cpuCatenatedBufArray->Fetch();
+    DECODE_CHK_NULL(buffer);
+    DECODE_CHK_STATUS(m_allocator->Resize(buffer, allocSize, lockableVideoMem));
+    m_cpuCatenatedBuf = buffer;
+
+    // Fall back to HuC copy if application buffer cannot be accessed by CPU
+    ResourceAutoLock resLock(m_allocator, decodeParams.m_dataBuffer);
+    m_cpuCatenation = (resLock.LockResourceForRead() != nullptr);
+
+    return MOS_STATUS_SUCCESS;
+}
+
+MOS_STATUS DecodeJpegInputBitstream::CpuCopySegment(const CodechalDecodeParams &decodeParams)
+{
+    DECODE_FUNC_CALL();
+
+    DECODE_CHK_NULL(decodeParams.m_dataBuffer);
+    DECODE_CHK_NULL(m_cpuCatenatedBuf);
+
+    if (decodeParams.m_dataSize == 0)
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
+    ResourceAutoLock srcLock(m_allocator, decodeParams.m_dataBuffer);
+    uint8_t *src = (uint8_t *)srcLock.LockResourceForRead();
+    DECODE_CHK_NULL(src);
+
+    // First segment waits for the decode which used this buffer last time, later
+    // segments write to the part of the buffer not handed to GPU yet.
+    ResourceAutoLock dstLock(m_allocator, &m_cpuCatenatedBuf->OsResource);
+    uint8_t *dst = (uint8_t *)((m_segmentsTotalSize == 0) ?
+        dstLock.LockResourceForWrite() : dstLock.LockResourceWithNoOverwrite());
+    DECODE_CHK_NULL(dst);
+
+    DECODE_CHK_STATUS(MOS_SecureMemcpy(dst + m_segmentsTotalSize, m_cpuCatenatedBuf->size - m_segmentsTotalSize,
+        src + decodeParams.m_dataOffset, decodeParams.m_dataSize));
+
+    return MOS_STATUS_SUCCESS;
+}
+
 
 }  // namespace decode
 
@@ -42,17 +42,45 @@ public:
     //!
     //! \brief  Decode input bitstream destructor
     //!
-    virtual ~DecodeJpegInputBitstream() {}
+    virtual ~DecodeJpegInputBitstream();
 
     MOS_STATUS Init(CodechalSetting &settings) override;
 
     MOS_STATUS Append(const CodechalDecodeParams &decodeParams) override;
     bool       IsComplete() override;
 
+protected:
+    //!
+    //! \brief  Prepare lockable catenated buffer for current picture
+    //! \details Small pictures are catenated on CPU, which saves the HuC copy
+    //!          submission and the context switch for every segment.
+    //! \param  [in] decodeParams
+    //!         Decode parameters of first segment
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS BeginCpuCatenation(const CodechalDecodeParams &decodeParams);
+
+    //!
+    //! \brief  Copy one bitstream segment to the catenated buffer on CPU
+    //! \param  [in] decodeParams
+    //!         Decode parameters of the segment
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS CpuCopySegment(const CodechalDecodeParams &decodeParams);
+
 private:
+    static constexpr uint32_t m_cpuCatenateMaxSize = 4 * 1024 * 1024;  //!< Max catenated size handled on CPU
+    static constexpr uint32_t m_cpuCatenatedBufNum = 3;                //!< Buffers rotated so CPU copy seldom waits for GPU
+
     JpegBasicFeature *m_jpegBasicFeature = nullptr;  //!< Decode basic feature
+    PMOS_INTERFACE   m_osInterface      = nullptr;  //!< OS interface
     bool             m_completeJpegScan = false;  //to indicate the scan was complete
     bool             m_completeBitStream = false;
+    bool             m_cpuCatenation     = false;    //!< Current picture is catenated on CPU
+    BufferArray     *m_cpuCatenatedBufArray = nullptr;  //!< Lockable catenated buffers for CPU copy
+    PMOS_BUFFER      m_cpuCatenatedBuf      = nullptr;  //!< Catenated buffer of current picture
 
 MEDIA_CLASS_DEFINE_END(decode__DecodeJpegInputBitstream)
 };
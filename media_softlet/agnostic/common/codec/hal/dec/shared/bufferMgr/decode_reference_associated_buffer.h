@@ -29,6 +29,8 @@
 #ifndef __DECODE_REFRENCE_ASSOCIATED_BUFFER_H__
 #define __DECODE_REFRENCE_ASSOCIATED_BUFFER_H__
 
+#include <array>
+#include <bitset>
 #include "decode_allocator.h"
 #include "decode_utils.h"
 #include "codec_hw_next.h"
@@ -78,11 +80,14 @@ public:
     {
         DECODE_FUNC_CALL();
 
-        for (auto& buf : m_activeBuffers)
+        for (uint32_t frameIdx = 0; frameIdx < m_maxFrameIdxNum; frameIdx++)
         {
-            m_bufferOp.Destroy(buf.second);
+            if (m_activeMask.test(frameIdx))
+            {
+                m_bufferOp.Destroy(m_activeBuffers[frameIdx]);
+            }
         }
-        m_activeBuffers.clear();
+        m_activeMask.reset();
 
         for (auto& buf : m_availableBuffers)
         {
@@ -112,7 +117,7 @@ public:
         DECODE_CHK_STATUS(m_bufferOp.Init(hwInterface, allocator, basicFeature));
 
         DECODE_ASSERT(m_availableBuffers.empty());
-        DECODE_ASSERT(m_activeBuffers.empty());
+        DECODE_ASSERT(m_activeMask.none());
 
         for (uint32_t i = 0; i < initialAllocNum; i++)
         {
@@ -187,14 +192,13 @@ public:
     {
         DECODE_FUNC_CALL();
 
-        auto iter = m_activeBuffers.find(frameIndex);
-        if (iter != m_activeBuffers.end())
+        if (frameIndex >= m_maxFrameIdxNum || !m_activeMask.test(frameIndex))
         {
-            DECODE_ASSERT(iter->second != nullptr);
-            return iter->second;
+            return nullptr;
         }
 
-        return nullptr;
+        DECODE_ASSERT(m_activeBuffers[frameIndex] != nullptr);
+        return m_activeBuffers[frameIndex];
     }
 
     //!
@@ -240,13 +244,13 @@ public:
 
         m_currentBuffer = nullptr;
 
-        for (auto iter = m_activeBuffers.begin(); iter != m_activeBuffers.end(); iter++)
+        DECODE_CHK_COND(curFrameIdx >= m_maxFrameIdxNum,
+            "Frame index %d exceeds the reference associated buffer table", curFrameIdx);
+
+        if (m_activeMask.test(curFrameIdx))
         {
-            if (curFrameIdx == iter->first)
-            {
-                m_currentBuffer = iter->second;
-                return MOS_STATUS_SUCCESS;
-            }
+            m_currentBuffer = m_activeBuffers[curFrameIdx];
+            return MOS_STATUS_SUCCESS;
         }
 
         // The function UpdateRefList always attach the retired buffers to end of
@@ -269,10 +273,8 @@ public:
         }
         m_bufferOp.Resize(m_currentBuffer);
 
-        auto ret = m_activeBuffers.insert(std::make_pair(curFrameIdx, m_currentBuffer));
-        DECODE_CHK_COND(ret.second == false,
-            "Failed to acitve reference associated buffer with index %d, maybe it is already existed",
-            ret.first->first);
+        m_activeBuffers[curFrameIdx] = m_currentBuffer;
+        m_activeMask.set(curFrameIdx);
 
         return MOS_STATUS_SUCCESS;
     }
@@ -293,65 +295,51 @@ protected:
     {
         DECODE_FUNC_CALL();
 
-        auto iter = m_activeBuffers.begin();
-        while (iter != m_activeBuffers.end())
+        std::bitset<m_maxFrameIdxNum> refMask;
+        for (auto frameIdx : refFrameList)
         {
-            if (iter->first == fixedFrameIdx)
+            if (frameIdx < m_maxFrameIdxNum)
             {
-                ++iter;
-                continue;
-            }
-
-            if (!IsReference(iter->first, curFrameIdx, refFrameList))
-            {
-                auto buffer = iter->second;
-                iter = m_activeBuffers.erase(iter);
-
-                m_availableBuffers.push_back(buffer);
-                DECODE_CHK_STATUS(m_bufferOp.Deactive(buffer));
-            }
-            else
-            {
-                ++iter;
+                refMask.set(frameIdx);
             }
         }
 
-        return MOS_STATUS_SUCCESS;
-    }
-
-    //!
-    //! \brief  Check if the index of buffer is persent in current reference list
-    //! \param  [in] frameIndex
-    //!         The frame index corresponding to buffer
-    //! \param  [in] frameIdx
-    //!         The frame index for current picture
-    //! \param  [in] refFrameList
-    //!         The frame indicies of reference frame list
-    //! \return  bool
-    //!         True if buffer is using by current frame, false if not
-    //!
-    bool IsReference(uint32_t frameIdx, uint32_t curFrameIdx, const std::vector<uint32_t> &refFrameList)
-    {
-        DECODE_FUNC_CALL();
-
-        if (frameIdx == curFrameIdx)
+        // Current frame never references its own buffer, while the fixed frame is always kept.
+        if (curFrameIdx < m_maxFrameIdxNum)
         {
-            return false;
+            refMask.reset(curFrameIdx);
+        }
+        if (fixedFrameIdx < m_maxFrameIdxNum)
+        {
+            refMask.set(fixedFrameIdx);
         }
 
-        for(auto iter : refFrameList)
+        // Retire in ascending frame index order, same as the buffers were kept before.
+        std::bitset<m_maxFrameIdxNum> retireMask = m_activeMask & ~refMask;
+        for (uint32_t frameIdx = 0; retireMask.any(); frameIdx++)
         {
-            if (frameIdx == iter)
+            if (!retireMask.test(frameIdx))
             {
-                return true;
+                continue;
             }
+            retireMask.reset(frameIdx);
+            m_activeMask.reset(frameIdx);
+
+            auto buffer = m_activeBuffers[frameIdx];
+            m_activeBuffers[frameIdx] = nullptr;
+
+            m_availableBuffers.push_back(buffer);
+            DECODE_CHK_STATUS(m_bufferOp.Deactive(buffer));
         }
 
-        return false;
+        return MOS_STATUS_SUCCESS;
     }
 
+    static constexpr uint32_t m_maxFrameIdxNum = 256;           //!< Frame index is 8 bits for all codecs
+
     BufferOp                        m_bufferOp;                //!< Buffer operation
-    std::map<uint32_t, BufferType*> m_activeBuffers;           //!< Active buffers corresponding to current reference frame list
+    std::array<BufferType*, m_maxFrameIdxNum> m_activeBuffers = {}; //!< Active buffers indexed by frame index
+    std::bitset<m_maxFrameIdxNum>   m_activeMask;              //!< Frame indices which have active buffer
     std::vector<BufferType*>        m_availableBuffers;        //!< Buffers in idle
     BufferType*                     m_currentBuffer = nullptr; //!< Point to buffer of current picture
 
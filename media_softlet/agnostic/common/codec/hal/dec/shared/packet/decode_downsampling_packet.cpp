@@ -36,6 +36,7 @@ DecodeDownSamplingPkt::DecodeDownSamplingPkt(DecodePipeline *pipeline, CodechalH
     : DecodeSubPacket(pipeline, hwInterface)
 {
     MOS_ZeroMemory(&m_sfcParams, sizeof(m_sfcParams));
+    MOS_ZeroMemory(&m_checkedKey, sizeof(m_checkedKey));
     m_hwInterface = hwInterface;
 }
 
@@ -90,14 +91,7 @@ MOS_STATUS DecodeDownSamplingPkt::Execute(MOS_COMMAND_BUFFER& cmdBuffer)
    
 
     DECODE_CHK_STATUS(InitSfcParams(m_sfcParams));
-    if (m_sfcInterface->IsParameterSupported(m_sfcParams) == MOS_STATUS_SUCCESS)
-    {
-        m_isSupported = true;
-    }
-    else
-    {
-        m_isSupported = false;
-    }
+    m_isSupported = IsSfcParamsSupported(m_sfcParams);
 
     if (m_isSupported)
     {
@@ -157,6 +151,45 @@ MOS_STATUS DecodeDownSamplingPkt::InitSfcParams(VDBOX_SFC_PARAMS &sfcParams)
     return MOS_STATUS_SUCCESS;
 }
 
+bool DecodeDownSamplingPkt::IsSfcParamsSupported(VDBOX_SFC_PARAMS &sfcParams)
+{
+    DECODE_FUNC_CALL();
+
+    if (sfcParams.output.surface == nullptr)
+    {
+        return false;
+    }
+
+    // Zero the key first so padding bytes compare equal
+    SfcSupportKey key;
+    MOS_ZeroMemory(&key, sizeof(key));
+    key.inputWidth           = sfcParams.input.width;
+    key.inputHeight          = sfcParams.input.height;
+    key.inputEffectiveWidth  = sfcParams.input.effectiveWidth;
+    key.inputEffectiveHeight = sfcParams.input.effectiveHeight;
+    key.inputFormat          = sfcParams.input.format;
+    key.outputFormat         = sfcParams.output.surface->Format;
+    key.outputTileType       = sfcParams.output.surface->TileType;
+    key.outputWidth          = sfcParams.output.surface->dwWidth;
+    key.outputHeight         = sfcParams.output.surface->dwHeight;
+    key.outputRcDst          = sfcParams.output.rcDst;
+    key.outputColorSpace     = sfcParams.output.colorSpace;
+    key.codecStandard        = sfcParams.videoParams.codecStandard;
+    if (key.codecStandard == CODECHAL_JPEG)
+    {
+        key.jpegChromaType = sfcParams.videoParams.jpeg.jpegChromaType;
+    }
+
+    if (!m_checkedKeyValid || memcmp(&key, &m_checkedKey, sizeof(key)) != 0)
+    {
+        m_checkedSupported = (m_sfcInterface->IsParameterSupported(sfcParams) == MOS_STATUS_SUCCESS);
+        m_checkedKey       = key;
+        m_checkedKeyValid  = true;
+    }
+
+    return m_checkedSupported;
+}
+
 }
 
 #endif  // !_DECODE_PROCESSING_SUPPORTED
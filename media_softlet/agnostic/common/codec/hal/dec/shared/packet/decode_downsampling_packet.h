@@ -102,8 +102,40 @@ public:
     virtual MOS_STATUS SetSfcMode(MEDIA_SFC_INTERFACE_MODE &mode) = 0;
 
 protected:
+    //!
+    //! \struct SfcSupportKey
+    //! \brief  Parameters which SFC support check depends on
+    //!
+    struct SfcSupportKey
+    {
+        uint32_t                  inputWidth;
+        uint32_t                  inputHeight;
+        uint32_t                  inputEffectiveWidth;
+        uint32_t                  inputEffectiveHeight;
+        MOS_FORMAT                inputFormat;
+        MOS_FORMAT                outputFormat;
+        MOS_TILE_TYPE             outputTileType;
+        uint32_t                  outputWidth;
+        uint32_t                  outputHeight;
+        RECT                      outputRcDst;
+        MEDIA_CSPACE              outputColorSpace;
+        CODECHAL_STANDARD         codecStandard;
+        CodecDecodeJpegChromaType jpegChromaType;
+    };
+
     virtual MOS_STATUS InitSfcParams(VDBOX_SFC_PARAMS &sfcParams);
 
+    //!
+    //! \brief  Check if SFC supports the parameters of current frame
+    //! \details Parameters seldom change within a session, so the result of last
+    //!          check is reused until one of the parameters it depends on changes.
+    //! \param  [in] sfcParams
+    //!         SFC parameters of current frame
+    //! \return bool
+    //!         true if supported
+    //!
+    bool IsSfcParamsSupported(VDBOX_SFC_PARAMS &sfcParams);
+
     std::shared_ptr<MediaSfcInterface>  m_sfcInterface = nullptr;
     DecodeBasicFeature        *m_basicFeature = nullptr;
     DecodeDownSamplingFeature *m_downSampling = nullptr;
@@ -111,6 +143,10 @@ protected:
 
     VDBOX_SFC_PARAMS           m_sfcParams;
 
+    SfcSupportKey              m_checkedKey;                //!< Parameters of last support check
+    bool                       m_checkedKeyValid = false;   //!< Indicate m_checkedKey is valid
+    bool                       m_checkedSupported = false;  //!< Result of last support check
+
 MEDIA_CLASS_DEFINE_END(decode__DecodeDownSamplingPkt)
 };
 
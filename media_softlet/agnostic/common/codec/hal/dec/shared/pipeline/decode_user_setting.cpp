@@ -170,6 +170,12 @@ MOS_STATUS DecodePipeline::InitUserSetting(MediaUserSettingSharedPtr userSetting
         MediaUserSetting::Group::Sequence,
         uint32_t(0),
         true);
+    DeclareUserSettingKey(
+        userSettingPtr,
+        "Decode Bitstream Scan",
+        MediaUserSetting::Group::Sequence,
+        int32_t(0),
+        false);
 #if (_DEBUG || _RELEASE_INTERNAL)
     DeclareUserSettingKeyForDebug(
         userSettingPtr,
@@ -85,9 +85,12 @@ MOS_STATUS DecodeScalabilityOption::SetScalabilityOption(ScalabilityPars *params
     {
         m_numPipe = (decPars->numVdbox >= m_maxNumMultiPipe) ? m_maxNumMultiPipe : m_typicalNumMultiPipe;
     }
-    else if (isRealTileDecode ||
-             (!decPars->disableVirtualTile &&
-              IsResolutionMatchMultiPipeThreshold1(decPars->frameWidth, decPars->frameHeight, decPars->surfaceFormat)))
+    else if (isRealTileDecode)
+    {
+        m_numPipe = GetRealTilePipeNum(decPars->numVdbox, decPars->numTileColumns);
+    }
+    else if (!decPars->disableVirtualTile &&
+             IsResolutionMatchMultiPipeThreshold1(decPars->frameWidth, decPars->frameHeight, decPars->surfaceFormat))
     {
         m_numPipe = m_typicalNumMultiPipe;
     }
@@ -227,6 +230,16 @@ bool DecodeScalabilityOption::IsResolutionMatchMultiPipeThreshold2(
     return ((frameWidth * frameHeight) >= (m_8KFrameWdithTh * m_8KFrameHeightTh));
 }
 
+uint8_t DecodeScalabilityOption::GetRealTilePipeNum(uint8_t numVdbox, uint32_t numTileColumns)
+{
+    // Tile columns are decoded independently in real tile mode, so give each column its own
+    // VDBox when possible instead of running extra passes on two pipes. The virtual engine
+    // and the decode GPU contexts are only set up for up to m_maxNumMultiPipe pipes.
+    uint32_t numPipe = MOS_MIN(numVdbox, numTileColumns);
+    numPipe          = MOS_MAX(numPipe, m_typicalNumMultiPipe);
+    return (uint8_t)MOS_MIN(numPipe, m_maxNumMultiPipe);
+}
+
 #if (_DEBUG || _RELEASE_INTERNAL)
 uint8_t DecodeScalabilityOption::GetUserPipeNum(uint8_t numVdbox, uint8_t userPipeNum)
 {
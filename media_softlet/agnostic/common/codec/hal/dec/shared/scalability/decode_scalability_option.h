@@ -134,6 +134,8 @@ private:
     virtual bool IsResolutionMatchMultiPipeThreshold2(
         uint32_t frameWidth, uint32_t frameHeight);
 
+    static uint8_t GetRealTilePipeNum(uint8_t numVdbox, uint32_t numTileColumns);
+
 #if (_DEBUG || _RELEASE_INTERNAL)
     inline static uint8_t GetUserPipeNum(uint8_t numVdbox, uint8_t userPipeNum);
 #endif
@@ -332,7 +332,7 @@ namespace encode
         return MOS_STATUS_SUCCESS;
     }
 
-    MOS_STATUS Av1Brc::SetConstForUpdate(VdencAv1HucBrcConstantData *params) const
+    MOS_STATUS Av1Brc::SetConstForUpdate(VdencAv1HucBrcConstantData *params, bool isIFrame) const
     {
         ENCODE_FUNC_CALL();
         ENCODE_CHK_NULL_RETURN(params);
@@ -354,7 +354,7 @@ namespace encode
         MEMCPY_CONST(CONST_LoopFilterLevelTabChroma, loopFilterLevelTabChroma);
 
         // ModeCosts depends on frame type
-        if (m_basicFeature->m_pictureCodingType == I_TYPE)
+        if (isIFrame)
         {
             MEMCPY_CONST(CONST_ModeCosts, hucModeCostsIFrame);
         }
@@ -742,23 +742,6 @@ namespace encode
         return MOS_STATUS_SUCCESS;
     }
 
-    MHW_SETPAR_DECL_SRC(HUC_VIRTUAL_ADDR_STATE, Av1Brc)
-    {
-        if (params.function == BRC_UPDATE)
-        {
-            const PMOS_RESOURCE brcConstDataBuffer = params.regionParams[5].presRegion;
-
-            auto hucConstData = (VdencAv1HucBrcConstantData *)m_allocator->LockResourceForWrite(brcConstDataBuffer);
-            ENCODE_CHK_NULL_RETURN(hucConstData);
-
-            SetConstForUpdate(hucConstData);
-
-            m_allocator->UnLock(brcConstDataBuffer);
-        }
-
-        return MOS_STATUS_SUCCESS;
-    }
-
     MHW_SETPAR_DECL_SRC(VDENC_PIPE_MODE_SELECT, Av1Brc)
     {
         if (m_brcEnabled)
@@ -162,13 +162,15 @@ enum AV1_BRC_FRAME_TYPE
         MOS_STATUS SetDmemForUpdate(VdencAv1HucBrcUpdateDmem *params) const;
 
         //!
-        //! \brief  Set Const data for brc update
+        //! \brief  Set Const data for brc update of a given frame type
         //! \param  [in] params
         //!         Pointer to parameters
+        //! \param  [in] isIFrame
+        //!         Fill the mode costs of I frames, else of P/B frames
         //! \return MOS_STATUS
         //!         MOS_STATUS_SUCCESS if success, else fail reason
         //!
-        MOS_STATUS SetConstForUpdate(VdencAv1HucBrcConstantData *params) const;
+        MOS_STATUS SetConstForUpdate(VdencAv1HucBrcConstantData *params, bool isIFrame) const;
 
         //!
         //! \brief  Set Dmem buffer for brc Init
@@ -200,7 +202,6 @@ enum AV1_BRC_FRAME_TYPE
 
         MHW_SETPAR_DECL_HDR(VDENC_PIPE_MODE_SELECT);
         MHW_SETPAR_DECL_HDR(HUC_DMEM_STATE);
-        MHW_SETPAR_DECL_HDR(HUC_VIRTUAL_ADDR_STATE);
 
         // const data
         static constexpr uint32_t m_brcHistoryBufSize       = 6080;   //!< BRC history buffer size
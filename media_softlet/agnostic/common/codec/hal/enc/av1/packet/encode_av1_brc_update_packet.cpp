@@ -28,6 +28,7 @@
 #include "encode_av1_brc_update_packet.h"
 #include "codechal_debug.h"
 #include "encode_av1_brc.h"
+#include "encode_const_table_registry.h"
 #include "encode_av1_vdenc_packet.h"
 #include "encode_av1_vdenc_lpla_enc.h"
 #if _MEDIA_RESERVED
@@ -95,14 +96,6 @@ namespace encode
 
         for (auto k = 0; k < CODECHAL_ENCODE_RECYCLED_BUFFER_NUM; k++)
         {
-            // Const Data buffer
-            allocParamsForBufferLinear.dwBytes = MOS_ALIGN_CEIL(m_vdencBrcConstDataBufferSize, CODECHAL_PAGE_SIZE);
-            allocParamsForBufferLinear.pBufName = "VDENC BRC Const Data Buffer";
-            allocParamsForBufferLinear.ResUsageType = MOS_HW_RESOURCE_USAGE_ENCODE_INTERNAL_WRITE;
-            allocatedbuffer       = m_allocator->AllocateResource(allocParamsForBufferLinear, true);
-            ENCODE_CHK_NULL_RETURN(allocatedbuffer);
-            m_vdencBrcConstDataBuffer[k] = *allocatedbuffer;
-
             // Pak insert buffer (input for HuC FW)
             allocParamsForBufferLinear.dwBytes  = CODECHAL_PAGE_SIZE;
             allocParamsForBufferLinear.pBufName = "VDENC Read Batch Buffer";
@@ -134,20 +127,52 @@ namespace encode
         return MOS_STATUS_SUCCESS;
     }
 
+    Av1BrcUpdatePkt::~Av1BrcUpdatePkt()
+    {
+        for (auto &constData : m_vdencBrcConstDataBuffer)
+        {
+            EncodeConstTableRegistry::GetInstance().Release(m_osInterface, constData);
+            constData = nullptr;
+        }
+    }
+
     MOS_STATUS Av1BrcUpdatePkt::SetConstDataHuCBrcUpdate()
     {
         ENCODE_FUNC_CALL();
 
-        MOS_STATUS eStatus = MOS_STATUS_SUCCESS;
+        if (m_vdencBrcConstDataBuffer[0] && m_vdencBrcConstDataBuffer[1])
+        {
+            return MOS_STATUS_SUCCESS;
+        }
 
-        auto hucConstData = (VdencAv1HucBrcConstantData *)m_allocator->LockResourceForWrite(&m_vdencBrcConstDataBuffer[m_pipeline->m_currRecycledBufIdx]);
-        ENCODE_CHK_NULL_RETURN(hucConstData);
+        auto brcFeature = dynamic_cast<Av1Brc *>(m_featureManager->GetFeature(Av1FeatureIDs::av1BrcFeature));
+        ENCODE_CHK_NULL_RETURN(brcFeature);
 
-        RUN_FEATURE_INTERFACE_RETURN(Av1Brc, Av1FeatureIDs::av1BrcFeature, SetConstForUpdate, hucConstData);
+        // The constant data only depends on the platform tables and on the frame
+        // type, so it is built once per device and shared read-only by all sessions.
+        for (uint32_t i = 0; i < 2; i++)
+        {
+            if (m_vdencBrcConstDataBuffer[i])
+            {
+                continue;
+            }
 
-        m_allocator->UnLock(&m_vdencBrcConstDataBuffer[m_pipeline->m_currRecycledBufIdx]);
+            bool                          isIFrame = (i == 0);
+            EncodeConstTableRegistry::Key key;
+            ENCODE_CHK_STATUS_RETURN(EncodeConstTableRegistry::GetKey(m_osInterface, m_basicFeature->m_mode, 0, i, key));
+
+            m_vdencBrcConstDataBuffer[i] = EncodeConstTableRegistry::GetInstance().Acquire(
+                m_osInterface,
+                key,
+                m_vdencBrcConstDataBufferSize,
+                "VDENC BRC Const Data Buffer",
+                [brcFeature, isIFrame](void *data) {
+                    return brcFeature->SetConstForUpdate((VdencAv1HucBrcConstantData *)data, isIFrame);
+                });
+            ENCODE_CHK_NULL_RETURN(m_vdencBrcConstDataBuffer[i]);
+        }
 
-        return eStatus;
+        return MOS_STATUS_SUCCESS;
     }
 
     MOS_STATUS Av1BrcUpdatePkt::Submit(MOS_COMMAND_BUFFER *commandBuffer, uint8_t packetPhase)
@@ -159,6 +184,7 @@ namespace encode
 
         ENCODE_CHK_STATUS_RETURN(ConstructBatchBufferHuCBRC(&m_vdencReadBatchBuffer[m_pipeline->m_currRecycledBufIdx][m_pipeline->GetCurrentPass()]));
         ENCODE_CHK_STATUS_RETURN(ConstructPakInsertHucBRC(&m_vdencPakInsertBatchBuffer[m_pipeline->m_currRecycledBufIdx]));
+        ENCODE_CHK_STATUS_RETURN(SetConstDataHuCBrcUpdate());
 
         bool firstTaskInPhase = packetPhase & firstPacket;
         bool requestProlog = false;
@@ -604,7 +630,7 @@ namespace encode
         params.regionParams[4].presRegion = resBrcDataBuffer;
         params.regionParams[4].isWritable = true;
         // Region 5 - Const Data (Input)
-        params.regionParams[5].presRegion = const_cast<PMOS_RESOURCE>(&m_vdencBrcConstDataBuffer[bufIdx]);
+        params.regionParams[5].presRegion = m_vdencBrcConstDataBuffer[m_basicFeature->m_pictureCodingType == I_TYPE ? 0 : 1];
         // Region 6 - Output SLBB - (Output)
         params.regionParams[6].presRegion = &vdenc2ndLevelBatchBuffer->OsResource;
         params.regionParams[6].isWritable = true;
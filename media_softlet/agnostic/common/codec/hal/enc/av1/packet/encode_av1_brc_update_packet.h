@@ -178,7 +178,7 @@ namespace encode
             m_featureManager = m_pipeline->GetPacketLevelFeatureManager(Av1Pipeline::Av1VdencPacket);
         }
 
-        virtual ~Av1BrcUpdatePkt() {}
+        virtual ~Av1BrcUpdatePkt();
 
         virtual MOS_STATUS Init() override;
 
@@ -237,7 +237,7 @@ namespace encode
         // Batch Buffer for VDEnc
         MOS_RESOURCE                            m_vdencReadBatchBuffer[CODECHAL_ENCODE_RECYCLED_BUFFER_NUM][VDENC_BRC_NUM_OF_PASSES] = {};  //!< VDEnc read batch buffer
         MOS_RESOURCE                            m_vdencPakInsertBatchBuffer[CODECHAL_ENCODE_RECYCLED_BUFFER_NUM] = {};                      //!< VDEnc read batch buffer
-        MOS_RESOURCE                            m_vdencBrcConstDataBuffer[CODECHAL_ENCODE_RECYCLED_BUFFER_NUM] = {};                        //!< VDEnc brc constant data buffer
+        PMOS_RESOURCE                           m_vdencBrcConstDataBuffer[2] = {};                                                          //!< VDEnc brc constant data for I and P/B frames, shared between sessions
 
         MOS_RESOURCE                            m_dataFromPicsBuffer = {}; //!< Data Buffer of Current and Reference Pictures for Weighted Prediction
         uint32_t                                m_vdenc2ndLevelBatchBufferSize[CODECHAL_ENCODE_RECYCLED_BUFFER_NUM] = { 0 };
@@ -349,6 +349,8 @@ namespace encode{
         ENCODE_CHK_NULL_RETURN(m_pipeline);
         if (!m_pipeline->IsDualEncEnabled())
         {
+            RUN_FEATURE_INTERFACE_RETURN(Av1EncodeTile, Av1FeatureIDs::encodeTile, BeginPatchTileLevelBatchPool, 0);
+
             for (uint32_t tileRow = 0; tileRow < numTileRows; tileRow++)
             {
                 for (uint32_t tileCol = 0; tileCol < numTileColumns; tileCol++)
@@ -359,6 +361,8 @@ namespace encode{
                         tileCol));
                 }
             }
+
+            RUN_FEATURE_INTERFACE_RETURN(Av1EncodeTile, Av1FeatureIDs::encodeTile, EndPatchTileLevelBatchPool);
         }
         else
         {
@@ -630,7 +630,7 @@ MOS_STATUS AvcBasicFeature::PackPictureHeader()
     packPicHeaderParams.pbNewPPSHeader     = &m_newPpsHeader;
     packPicHeaderParams.pbNewSeqHeader     = &m_newSeqHeader;
 
-    ENCODE_CHK_STATUS_RETURN(AvcEncodeHeaderPacker::PackPictureHeader(&packPicHeaderParams));
+    ENCODE_CHK_STATUS_RETURN(AvcEncodeHeaderPacker::PackPictureHeader(&packPicHeaderParams, &m_packedHeaderCache));
 
     return MOS_STATUS_SUCCESS;
 }
@@ -28,6 +28,7 @@
 
 #include "encode_basic_feature.h"
 #include "encode_avc_reference_frames.h"
+#include "encode_avc_header_packer.h"
 #include "mhw_vdbox_vdenc_itf.h"
 #include "mhw_vdbox_mfx_itf.h"
 #include "mhw_vdbox_huc_itf.h"
@@ -240,6 +241,8 @@ public:
     bool                            m_brcAdaptiveRegionBoostSupported = false;  //!< Adaptive Region Boost supported flag
     bool                            m_brcAdaptiveRegionBoostEnabled   = false;  //!< Adaptive Region Boost enabled flag
 
+    AvcPackedHeaderCache            m_packedHeaderCache;                        //!< SPS/PPS reused across frames with unchanged parameters
+
 protected:
     MOS_STATUS SetSequenceStructs();
     MOS_STATUS SetPictureStructs();
@@ -26,6 +26,7 @@
 
 #include "encode_avc_header_packer.h"
 #include "encode_utils.h"
+#include "bitstream_writer.h"
 
 namespace encode
 {
@@ -52,98 +53,19 @@ static void SetNalUnit(uint8_t **bsbuffer, uint8_t refIDC, CODECHAL_ENCODE_AVC_N
 
 static void PutBit(BSBuffer *bsbuffer, uint32_t code)
 {
-    if (code & 1)
-    {
-        *(bsbuffer->pCurrent) = (*(bsbuffer->pCurrent) | (uint8_t)(0x01 << (7 - bsbuffer->BitOffset)));
-    }
-
-    bsbuffer->BitOffset++;
-    if (bsbuffer->BitOffset == 8)
-    {
-        bsbuffer->BitOffset = 0;
-        bsbuffer->pCurrent++;
-        *(bsbuffer->pCurrent) = 0;
-    }
-}
-
-static void PutBitsSub(BSBuffer *bsbuffer, uint32_t code, uint32_t length)
-{
-    uint8_t *byte = bsbuffer->pCurrent;
-
-    // make sure that the number of bits given is <= 24
-    ENCODE_ASSERT(length <= 24);
-
-    code <<= (32 - length);
-
-    // shift field so that the given code begins at the current bit
-    // offset in the most significant byte of the 32-bit word
-    length += bsbuffer->BitOffset;
-    code >>= bsbuffer->BitOffset;
-
-    // write bytes back into memory, big-endian
-    byte[0] = (uint8_t)((code >> 24) | byte[0]);
-    byte[1] = (uint8_t)(code >> 16);
-    if (length > 16)
-    {
-        byte[2] = (uint8_t)(code >> 8);
-        byte[3] = (uint8_t)code;
-    }
-    else
-    {
-        byte[2] = 0;
-    }
-
-    // update bitstream pointer and bit offset
-    bsbuffer->pCurrent += (length >> 3);
-    bsbuffer->BitOffset = (length & 7);
+    BitstreamWriter::PutBitsAt(bsbuffer->pCurrent, bsbuffer->BitOffset, 1, code & 1);
 }
 
 static void PutBits(BSBuffer *bsbuffer, uint32_t code, uint32_t length)
 {
-    uint32_t code1, code2;
-
-    // temp solution, only support up to 32 bits based on current usage
     ENCODE_ASSERT(length <= 32);
 
-    if (length >= 24)
-    {
-        code1 = code & 0xFFFF;
-        code2 = code >> 16;
-
-        // high bits go first
-        PutBitsSub(bsbuffer, code2, length - 16);
-        PutBitsSub(bsbuffer, code1, 16);
-    }
-    else
-    {
-        PutBitsSub(bsbuffer, code, length);
-    }
+    BitstreamWriter::PutBitsAt(bsbuffer->pCurrent, bsbuffer->BitOffset, length, code);
 }
 
 static void PutVLCCode(BSBuffer *bsbuffer, uint32_t code)
 {
-    uint8_t  leadingZeroBits, bitcount;
-    uint32_t code1, bits;
-
-    code1    = code + 1;
-    bitcount = 0;
-    while (code1)
-    {
-        code1 >>= 1;
-        bitcount++;
-    }
-
-    if (bitcount == 1)
-    {
-        PutBit(bsbuffer, 1);
-    }
-    else
-    {
-        leadingZeroBits = bitcount - 1;
-        bits            = code + 1 - (1 << leadingZeroBits);
-        PutBits(bsbuffer, 1, leadingZeroBits + 1);
-        PutBits(bsbuffer, bits, leadingZeroBits);
-    }
+    BitstreamWriter::PutGolombAt(bsbuffer->pCurrent, bsbuffer->BitOffset, code);
 }
 
 static void SetTrailingBits(BSBuffer *bsbuffer)
@@ -178,6 +100,120 @@ static void PackScalingList(BSBuffer *bsbuffer, uint8_t *scalingList, uint8_t si
     }
 }
 
+bool AvcPackedHeaderCache::MatchIqMatrix(const CODEC_AVC_IQ_MATRIX_PARAMS &cached, bool cachedValid, PCODEC_AVC_IQ_MATRIX_PARAMS iqMatrix)
+{
+    if (iqMatrix == nullptr)
+    {
+        return !cachedValid;
+    }
+    return cachedValid && !memcmp(&cached, iqMatrix, sizeof(cached));
+}
+
+bool AvcPackedHeaderCache::MatchSps(PCODECHAL_ENCODE_AVC_PACK_PIC_HEADER_PARAMS params) const
+{
+    if (!m_spsValid ||
+        params->dwFrameHeight != m_frameHeight ||
+        params->dwOriFrameHeight != m_oriFrameHeight ||
+        memcmp(&m_seqParams, params->pSeqParams, sizeof(m_seqParams)))
+    {
+        return false;
+    }
+
+    if (params->pSeqParams->vui_parameters_present_flag &&
+        (params->pAvcVuiParams == nullptr || !m_vuiValid ||
+         memcmp(&m_vuiParams, params->pAvcVuiParams, sizeof(m_vuiParams))))
+    {
+        return false;
+    }
+
+    return !params->pSeqParams->seq_scaling_matrix_present_flag ||
+           MatchIqMatrix(m_spsIqMatrix, m_spsIqValid, params->pAvcIQMatrixParams);
+}
+
+void AvcPackedHeaderCache::UpdateSps(PCODECHAL_ENCODE_AVC_PACK_PIC_HEADER_PARAMS params, const uint8_t *data, uint32_t size)
+{
+    m_seqParams      = *params->pSeqParams;
+    m_frameHeight    = params->dwFrameHeight;
+    m_oriFrameHeight = params->dwOriFrameHeight;
+
+    m_vuiValid = params->pAvcVuiParams != nullptr;
+    if (m_vuiValid)
+    {
+        m_vuiParams = *params->pAvcVuiParams;
+    }
+
+    m_spsIqValid = params->pAvcIQMatrixParams != nullptr;
+    if (m_spsIqValid)
+    {
+        m_spsIqMatrix = *params->pAvcIQMatrixParams;
+    }
+
+    m_sps.assign(data, data + size);
+    m_spsValid = true;
+}
+
+void AvcPackedHeaderCache::GetPpsKey(PCODECHAL_ENCODE_AVC_PACK_PIC_HEADER_PARAMS params, PpsKey &key)
+{
+    PCODEC_AVC_ENCODE_PIC_PARAMS picParams = params->pPicParams;
+
+    MOS_ZeroMemory(&key, sizeof(key));
+    key.profile                   = params->pSeqParams->Profile;
+    key.picParameterSetId         = picParams->pic_parameter_set_id;
+    key.seqParameterSetId         = picParams->seq_parameter_set_id;
+    key.numRefIdxL0ActiveMinus1   = picParams->num_ref_idx_l0_active_minus1;
+    key.numRefIdxL1ActiveMinus1   = picParams->num_ref_idx_l1_active_minus1;
+    key.numSliceGroupsMinus1      = picParams->num_slice_groups_minus1;
+    key.picInitQpMinus26          = picParams->pic_init_qp_minus26;
+    key.picInitQsMinus26          = picParams->pic_init_qs_minus26;
+    key.chromaQpIndexOffset       = picParams->chroma_qp_index_offset;
+    key.secondChromaQpIndexOffset = picParams->second_chroma_qp_index_offset;
+    key.weightedBipredIdc         = picParams->weighted_bipred_idc;
+    key.flags                     = (picParams->entropy_coding_mode_flag << 0) |
+                                    (picParams->pic_order_present_flag << 1) |
+                                    (picParams->weighted_pred_flag << 2) |
+                                    (picParams->constrained_intra_pred_flag << 3) |
+                                    (picParams->transform_8x8_mode_flag << 4) |
+                                    (picParams->pic_scaling_matrix_present_flag << 5) |
+                                    (picParams->deblocking_filter_control_present_flag << 6) |
+                                    (picParams->redundant_pic_cnt_present_flag << 7);
+    MOS_SecureMemcpy(key.picScalingListPresentFlag,
+        sizeof(key.picScalingListPresentFlag),
+        picParams->pic_scaling_list_present_flag,
+        sizeof(picParams->pic_scaling_list_present_flag));
+}
+
+bool AvcPackedHeaderCache::MatchPps(PCODECHAL_ENCODE_AVC_PACK_PIC_HEADER_PARAMS params) const
+{
+    if (!m_ppsValid || params->pPicParams == nullptr)
+    {
+        return false;
+    }
+
+    PpsKey key;
+    GetPpsKey(params, key);
+    if (memcmp(&key, &m_ppsKey, sizeof(key)))
+    {
+        return false;
+    }
+
+    return !params->pPicParams->pic_scaling_matrix_present_flag ||
+           MatchIqMatrix(m_ppsIqMatrix, m_ppsIqValid, params->pAvcIQMatrixParams);
+}
+
+void AvcPackedHeaderCache::UpdatePps(PCODECHAL_ENCODE_AVC_PACK_PIC_HEADER_PARAMS params, const uint8_t *data, uint32_t size)
+{
+    GetPpsKey(params, m_ppsKey);
+
+    m_ppsIqValid = params->pAvcIQMatrixParams != nullptr;
+    if (m_ppsIqValid)
+    {
+        m_ppsIqMatrix = *params->pAvcIQMatrixParams;
+    }
+
+    m_pps.assign(data, data + size);
+    m_ppsValid = true;
+}
+
 MOS_STATUS AvcEncodeHeaderPacker::PackAUDParams(PCODECHAL_ENCODE_AVC_PACK_PIC_HEADER_PARAMS params)
 {
     uint32_t   picType;
@@ -521,7 +557,26 @@ MOS_STATUS AvcEncodeHeaderPacker::PackPicParams(PCODECHAL_ENCODE_AVC_PACK_PIC_HE
     return eStatus;
 }
 
-MOS_STATUS AvcEncodeHeaderPacker::PackPictureHeader(PCODECHAL_ENCODE_AVC_PACK_PIC_HEADER_PARAMS params)
+MOS_STATUS AvcEncodeHeaderPacker::PutCachedNalUnit(PBSBuffer bsbuffer, const std::vector<uint8_t> &nalUnit)
+{
+    ENCODE_CHK_NULL_RETURN(bsbuffer);
+    ENCODE_CHK_COND_RETURN(bsbuffer->BitOffset != 0, "NAL unit must start byte aligned");
+
+    uint32_t used = (uint32_t)(bsbuffer->pCurrent - bsbuffer->pBase);
+    ENCODE_CHK_COND_RETURN(used + nalUnit.size() >= bsbuffer->BufferSize, "Bitstream buffer too small for cached NAL unit");
+
+    ENCODE_CHK_STATUS_RETURN(MOS_SecureMemcpy(
+        bsbuffer->pCurrent,
+        bsbuffer->BufferSize - used,
+        nalUnit.data(),
+        nalUnit.size()));
+    bsbuffer->pCurrent += nalUnit.size();
+    *bsbuffer->pCurrent = 0;  // Clear the next byte
+
+    return MOS_STATUS_SUCCESS;
+}
+
+MOS_STATUS AvcEncodeHeaderPacker::PackPictureHeader(PCODECHAL_ENCODE_AVC_PACK_PIC_HEADER_PARAMS params, AvcPackedHeaderCache *cache)
 {
     ENCODE_FUNC_CALL();
 
@@ -568,9 +623,24 @@ MOS_STATUS AvcEncodeHeaderPacker::PackPictureHeader(PCODECHAL_ENCODE_AVC_PACK_PI
         params->ppNALUnitParams[indexNALUnit]->uiNalUnitType             = CODECHAL_ENCODE_AVC_NAL_UT_SPS;
         params->ppNALUnitParams[indexNALUnit]->bInsertEmulationBytes     = true;
         params->ppNALUnitParams[indexNALUnit]->uiSkipEmulationCheckCount = 4;
-        SetNalUnit(&bsbuffer->pCurrent, 1, CODECHAL_ENCODE_AVC_NAL_UT_SPS);
-        ENCODE_CHK_STATUS_RETURN(PackSeqParams(params));
-        SetTrailingBits(bsbuffer);
+        if (cache && cache->MatchSps(params))
+        {
+            ENCODE_CHK_STATUS_RETURN(PutCachedNalUnit(bsbuffer, cache->GetSps()));
+            *params->pbNewSeqHeader = 1;
+        }
+        else
+        {
+            SetNalUnit(&bsbuffer->pCurrent, 1, CODECHAL_ENCODE_AVC_NAL_UT_SPS);
+            ENCODE_CHK_STATUS_RETURN(PackSeqParams(params));
+            SetTrailingBits(bsbuffer);
+            if (cache)
+            {
+                cache->UpdateSps(
+                    params,
+                    bsbuffer->pBase + params->ppNALUnitParams[indexNALUnit]->uiOffset,
+                    (uint32_t)(bsbuffer->pCurrent - bsbuffer->pBase - params->ppNALUnitParams[indexNALUnit]->uiOffset));
+            }
+        }
         params->ppNALUnitParams[indexNALUnit]->uiSize =
             (uint32_t)(bsbuffer->pCurrent -
                        bsbuffer->pBase -
@@ -583,9 +653,24 @@ MOS_STATUS AvcEncodeHeaderPacker::PackPictureHeader(PCODECHAL_ENCODE_AVC_PACK_PI
     params->ppNALUnitParams[indexNALUnit]->uiNalUnitType             = CODECHAL_ENCODE_AVC_NAL_UT_PPS;
     params->ppNALUnitParams[indexNALUnit]->bInsertEmulationBytes     = true;
     params->ppNALUnitParams[indexNALUnit]->uiSkipEmulationCheckCount = 4;
-    SetNalUnit(&bsbuffer->pCurrent, 1, CODECHAL_ENCODE_AVC_NAL_UT_PPS);
-    ENCODE_CHK_STATUS_RETURN(PackPicParams(params));
-    SetTrailingBits(bsbuffer);
+    if (cache && cache->MatchPps(params))
+    {
+        ENCODE_CHK_STATUS_RETURN(PutCachedNalUnit(bsbuffer, cache->GetPps()));
+        *params->pbNewPPSHeader = 1;
+    }
+    else
+    {
+        SetNalUnit(&bsbuffer->pCurrent, 1, CODECHAL_ENCODE_AVC_NAL_UT_PPS);
+        ENCODE_CHK_STATUS_RETURN(PackPicParams(params));
+        SetTrailingBits(bsbuffer);
+        if (cache)
+        {
+            cache->UpdatePps(
+                params,
+                bsbuffer->pBase + params->ppNALUnitParams[indexNALUnit]->uiOffset,
+                (uint32_t)(bsbuffer->pCurrent - bsbuffer->pBase - params->ppNALUnitParams[indexNALUnit]->uiOffset));
+        }
+    }
     params->ppNALUnitParams[indexNALUnit]->uiSize =
         (uint32_t)(bsbuffer->pCurrent -
                    bsbuffer->pBase -
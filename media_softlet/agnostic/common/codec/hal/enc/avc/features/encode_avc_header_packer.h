@@ -27,10 +27,86 @@
 #define __ENCODE_AVC_HEADER_PACKER_H__
 
 #include "codec_def_encode_avc.h"
+#include <vector>
 
 namespace encode
 {
 
+//!
+//! \brief  Packed SPS and PPS NAL units kept across frames
+//! \details The SPS is keyed on the sequence, VUI and scaling list parameters and the
+//!          frame heights it is packed from, the PPS only on the picture syntax elements
+//!          it carries, since the rest of the picture parameters changes every frame.
+//!          Every input of the packers is part of a key, so a new sequence or a
+//!          resolution change never needs an explicit reset. The cached bytes
+//!          start at the NAL start code and have no emulation prevention bytes, which
+//!          are inserted by the PAK when the header is sent to the bitstream.
+//!
+class AvcPackedHeaderCache
+{
+public:
+    struct PpsKey
+    {
+        uint8_t  profile;
+        uint8_t  picParameterSetId;
+        uint8_t  seqParameterSetId;
+        uint8_t  numRefIdxL0ActiveMinus1;
+        uint8_t  numRefIdxL1ActiveMinus1;
+        uint8_t  numSliceGroupsMinus1;
+        int8_t   picInitQpMinus26;
+        int8_t   picInitQsMinus26;
+        int8_t   chromaQpIndexOffset;
+        int8_t   secondChromaQpIndexOffset;
+        uint8_t  flags;
+        uint8_t  weightedBipredIdc;
+        uint16_t picScalingListPresentFlag[12];
+    };
+
+    //!
+    //! \brief  Check if the cached SPS was packed from the same parameters
+    //!
+    bool MatchSps(PCODECHAL_ENCODE_AVC_PACK_PIC_HEADER_PARAMS params) const;
+
+    //!
+    //! \brief  Check if the cached PPS was packed from the same parameters
+    //!
+    bool MatchPps(PCODECHAL_ENCODE_AVC_PACK_PIC_HEADER_PARAMS params) const;
+
+    //!
+    //! \brief  Save a freshly packed SPS together with its parameters
+    //!
+    void UpdateSps(PCODECHAL_ENCODE_AVC_PACK_PIC_HEADER_PARAMS params, const uint8_t *data, uint32_t size);
+
+    //!
+    //! \brief  Save a freshly packed PPS together with its parameters
+    //!
+    void UpdatePps(PCODECHAL_ENCODE_AVC_PACK_PIC_HEADER_PARAMS params, const uint8_t *data, uint32_t size);
+
+    const std::vector<uint8_t> &GetSps() const { return m_sps; }
+    const std::vector<uint8_t> &GetPps() const { return m_pps; }
+
+protected:
+    static void GetPpsKey(PCODECHAL_ENCODE_AVC_PACK_PIC_HEADER_PARAMS params, PpsKey &key);
+    static bool MatchIqMatrix(const CODEC_AVC_IQ_MATRIX_PARAMS &cached, bool cachedValid, PCODEC_AVC_IQ_MATRIX_PARAMS iqMatrix);
+
+    CODEC_AVC_ENCODE_SEQUENCE_PARAMS m_seqParams       = {};
+    CODECHAL_ENCODE_AVC_VUI_PARAMS   m_vuiParams       = {};
+    CODEC_AVC_IQ_MATRIX_PARAMS       m_spsIqMatrix     = {};
+    CODEC_AVC_IQ_MATRIX_PARAMS       m_ppsIqMatrix     = {};
+    PpsKey                           m_ppsKey          = {};
+    uint32_t                         m_frameHeight     = 0;
+    uint32_t                         m_oriFrameHeight  = 0;
+    bool                             m_vuiValid        = false;
+    bool                             m_spsIqValid      = false;
+    bool                             m_ppsIqValid      = false;
+    bool                             m_spsValid        = false;
+    bool                             m_ppsValid        = false;
+    std::vector<uint8_t>             m_sps;
+    std::vector<uint8_t>             m_pps;
+
+MEDIA_CLASS_DEFINE_END(encode__AvcPackedHeaderCache)
+};
+
 class AvcEncodeHeaderPacker
 {
 public:
@@ -49,10 +125,12 @@ public:
     //! \brief    Use to pack picture header related params
     //! \param    [in] params
     //!           picture header pack params
+    //! \param    [in, out] cache
+    //!           packed SPS/PPS reused when their parameters did not change, can be nullptr
     //! \return   MOS_STATUS
     //!           MOS_STATUS_SUCCESS if success, else fail reason
     //!
-    static MOS_STATUS PackPictureHeader(PCODECHAL_ENCODE_AVC_PACK_PIC_HEADER_PARAMS params);
+    static MOS_STATUS PackPictureHeader(PCODECHAL_ENCODE_AVC_PACK_PIC_HEADER_PARAMS params, AvcPackedHeaderCache *cache = nullptr);
 
     static MOS_STATUS PackSliceHeader(PCODECHAL_ENCODE_AVC_PACK_SLC_HEADER_PARAMS params);
 
@@ -113,6 +191,19 @@ protected:
     //!
     static MOS_STATUS PackPicParams(PCODECHAL_ENCODE_AVC_PACK_PIC_HEADER_PARAMS params);
 
+    //!
+    //! \brief    Copy a cached NAL unit to the current byte aligned position
+    //!
+    //! \param    [in] bsbuffer
+    //!           Bitstream buffer to write to
+    //! \param    [in] nalUnit
+    //!           Packed NAL unit including its start code
+    //!
+    //! \return   MOS_STATUS
+    //!           Return MOS_STATUS_SUCCESS if call success, else fail reason
+    //!
+    static MOS_STATUS PutCachedNalUnit(PBSBuffer bsbuffer, const std::vector<uint8_t> &nalUnit);
+
     static MOS_STATUS RefPicListReordering(PCODECHAL_ENCODE_AVC_PACK_SLC_HEADER_PARAMS params);
 
     static MOS_STATUS PredWeightTable(PCODECHAL_ENCODE_AVC_PACK_SLC_HEADER_PARAMS params);
@@ -460,6 +460,8 @@ namespace encode {
         CODECHAL_DEBUG_TOOL(
             ENCODE_CHK_STATUS_RETURN(SetSliceStateCommonParams(m_basicFeature->sliceState)))
 
+        m_sliceRefStateSlice = -1;
+
         for (uint16_t slcCount = 0; slcCount < m_basicFeature->m_numSlices; slcCount++)
         {
             m_basicFeature->m_curNumSlices = slcCount;
@@ -1552,9 +1554,7 @@ namespace encode {
 
         ENCODE_CHK_NULL_RETURN(cmdBuffer);
 
-        ENCODE_CHK_STATUS_RETURN(AddAllCmds_MFX_AVC_REF_IDX_STATE(cmdBuffer));
-
-        ENCODE_CHK_STATUS_RETURN(AddAllCmds_MFX_AVC_WEIGHTOFFSET_STATE(cmdBuffer));
+        ENCODE_CHK_STATUS_RETURN(AddSliceRefStateCmds(cmdBuffer));
 
         auto brcFeature = dynamic_cast<AvcEncodeBRC *>(m_featureManager->GetFeature(AvcFeatureIDs::avcBrcFeature));
         ENCODE_CHK_NULL_RETURN(brcFeature);
@@ -2282,6 +2282,80 @@ namespace encode {
         return MOS_STATUS_SUCCESS;
     }
 
+    bool AvcVdencPkt::IsSliceRefStateEqual(
+        const CODEC_AVC_ENCODE_SLICE_PARAMS &slcParams0,
+        const CODEC_AVC_ENCODE_SLICE_PARAMS &slcParams1) const
+    {
+        if (Slice_Type[slcParams0.slice_type] != Slice_Type[slcParams1.slice_type] ||
+            slcParams0.num_ref_idx_l0_active_minus1 != slcParams1.num_ref_idx_l0_active_minus1 ||
+            slcParams0.num_ref_idx_l1_active_minus1 != slcParams1.num_ref_idx_l1_active_minus1 ||
+            slcParams0.luma_log2_weight_denom != slcParams1.luma_log2_weight_denom ||
+            slcParams0.chroma_log2_weight_denom != slcParams1.chroma_log2_weight_denom)
+        {
+            return false;
+        }
+
+        uint32_t numRefForList[2] = {
+            (uint32_t)MOS_MIN(slcParams0.num_ref_idx_l0_active_minus1 + 1, CODEC_MAX_NUM_REF_FIELD),
+            (uint32_t)MOS_MIN(slcParams0.num_ref_idx_l1_active_minus1 + 1, CODEC_MAX_NUM_REF_FIELD)};
+
+        for (auto list = 0; list < 2; list++)
+        {
+            if (slcParams0.luma_weight_flag[list] != slcParams1.luma_weight_flag[list] ||
+                slcParams0.chroma_weight_flag[list] != slcParams1.chroma_weight_flag[list])
+            {
+                return false;
+            }
+
+            for (uint32_t i = 0; i < numRefForList[list]; i++)
+            {
+                if (slcParams0.RefPicList[list][i].FrameIdx != slcParams1.RefPicList[list][i].FrameIdx ||
+                    slcParams0.RefPicList[list][i].PicFlags != slcParams1.RefPicList[list][i].PicFlags)
+                {
+                    return false;
+                }
+            }
+
+            if (memcmp(slcParams0.Weights[list], slcParams1.Weights[list], numRefForList[list] * sizeof(slcParams0.Weights[list][0])) != 0)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    MOS_STATUS AvcVdencPkt::AddSliceRefStateCmds(PMOS_COMMAND_BUFFER cmdBuffer)
+    {
+        ENCODE_FUNC_CALL();
+        ENCODE_CHK_NULL_RETURN(cmdBuffer);
+
+        uint16_t slcCount = m_basicFeature->m_curNumSlices;
+
+        if (m_sliceRefStateSlice >= 0 &&
+            IsSliceRefStateEqual(m_sliceParams[m_sliceRefStateSlice], m_sliceParams[slcCount]))
+        {
+            // None of these commands carries a graphics address, so a plain copy needs no patching
+            if (!m_sliceRefStateCmds.empty())
+            {
+                ENCODE_CHK_STATUS_RETURN(m_osInterface->pfnAddCommand(cmdBuffer, m_sliceRefStateCmds.data(), (uint32_t)m_sliceRefStateCmds.size()));
+            }
+            return MOS_STATUS_SUCCESS;
+        }
+
+        uint8_t *cmdStart    = (uint8_t *)cmdBuffer->pCmdPtr;
+        int32_t  startOffset = cmdBuffer->iOffset;
+
+        ENCODE_CHK_STATUS_RETURN(AddAllCmds_MFX_AVC_REF_IDX_STATE(cmdBuffer));
+
+        ENCODE_CHK_STATUS_RETURN(AddAllCmds_MFX_AVC_WEIGHTOFFSET_STATE(cmdBuffer));
+
+        m_sliceRefStateCmds.assign(cmdStart, cmdStart + (cmdBuffer->iOffset - startOffset));
+        m_sliceRefStateSlice = slcCount;
+
+        return MOS_STATUS_SUCCESS;
+    }
+
     MHW_SETPAR_DECL_SRC(MFX_SURFACE_STATE, AvcVdencPkt)
     {
         params.surfaceId = m_curMfxSurfStateId;
@@ -34,6 +34,7 @@
 #include "mhw_vdbox_vdenc_itf.h"
 #include "mhw_vdbox_mfx_itf.h"
 #include "mhw_mi_itf.h"
+#include <vector>
 
 namespace encode
 {
@@ -410,6 +411,27 @@ protected:
 
     MOS_STATUS AddAllCmds_MFX_AVC_WEIGHTOFFSET_STATE(PMOS_COMMAND_BUFFER cmdBuffer) const;
 
+    //!
+    //! \brief    Add reference list and weight offset states of current slice
+    //! \details  Slices of a frame usually share reference lists and weights, the
+    //!           commands built for one slice are kept and copied for following
+    //!           slices with the same parameters instead of being set up again.
+    //! \param    [in] cmdBuffer
+    //!           command buffer
+    //! \return   MOS_STATUS
+    //!           MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS AddSliceRefStateCmds(PMOS_COMMAND_BUFFER cmdBuffer);
+
+    //!
+    //! \brief    Check whether two slices have the same reference list and weight offset states
+    //! \return   bool
+    //!           true if the states built for one slice can be used for the other
+    //!
+    bool IsSliceRefStateEqual(
+        const CODEC_AVC_ENCODE_SLICE_PARAMS &slcParams0,
+        const CODEC_AVC_ENCODE_SLICE_PARAMS &slcParams1) const;
+
     MHW_SETPAR_DECL_HDR(MFX_SURFACE_STATE);
 
     MHW_SETPAR_DECL_HDR(MFX_PIPE_BUF_ADDR_STATE);
@@ -505,6 +527,9 @@ protected:
     bool                   m_lastSlice = false;
     bool                   m_lastPic   = false;
 
+    std::vector<uint8_t>   m_sliceRefStateCmds;                 //!< Reference list and weight offset commands of m_sliceRefStateSlice
+    int32_t                m_sliceRefStateSlice = -1;           //!< Slice the kept commands were built for, -1 if none
+
 MEDIA_CLASS_DEFINE_END(encode__AvcVdencPkt)
 };
 
@@ -218,6 +218,7 @@ MOS_STATUS AvcVdencPipeline::ActivateVdencVideoPackets()
             m_activePacketList.back().immediateSubmit = true;
             return MOS_STATUS_SUCCESS;
         }
+        SetPreEncSubmitAhead();
     }
 
     if (brcFeature->IsBRCInitRequired())
@@ -416,10 +416,28 @@ namespace encode
             ENCODE_CHK_NULL_RETURN(m_basicFeature->m_hevcSeqParams);
             ENCODE_CHK_NULL_RETURN(m_basicFeature->m_hevcPicParams);
 
-            for (uint8_t qp = 0; qp < HUC_QP_RANGE; qp++)
+            auto seqParams = m_basicFeature->m_hevcSeqParams;
+            auto picParams = m_basicFeature->m_hevcPicParams;
+
+            // The depth based lambda only depends on a few picture level inputs, which repeat
+            // every GOP, so skip the per QP pow/sqrt evaluation while they are unchanged.
+            if (!m_lambdaKey.valid ||
+                m_lambdaKey.codingType != picParams->CodingType ||
+                m_lambdaKey.gopRefDist != seqParams->GopRefDist ||
+                m_lambdaKey.hierarchLevelPlus1 != picParams->HierarchLevelPlus1 ||
+                m_lambdaKey.lowDelayMode != seqParams->LowDelayMode)
             {
-                ENCODE_CHK_STATUS_RETURN(SetHevcDepthBasedLambda(m_basicFeature->m_hevcSeqParams, m_basicFeature->m_hevcPicParams,
-                    qp, m_sadLambdaArray[qp], m_rdLambdaArray[qp]));
+                for (uint8_t qp = 0; qp < HUC_QP_RANGE; qp++)
+                {
+                    ENCODE_CHK_STATUS_RETURN(SetHevcDepthBasedLambda(seqParams, picParams,
+                        qp, m_sadLambdaArray[qp], m_rdLambdaArray[qp]));
+                }
+
+                m_lambdaKey.valid              = true;
+                m_lambdaKey.codingType         = picParams->CodingType;
+                m_lambdaKey.gopRefDist         = seqParams->GopRefDist;
+                m_lambdaKey.hierarchLevelPlus1 = picParams->HierarchLevelPlus1;
+                m_lambdaKey.lowDelayMode       = seqParams->LowDelayMode;
             }
 
             if (m_basicFeature->m_hevcPicParams->CodingType == I_TYPE)
@@ -426,6 +426,16 @@ namespace encode
         uint16_t           *m_rdLambdaArray                                              = nullptr;
         uint16_t           *m_sadLambdaArray                                             = nullptr;
 
+        //! Inputs of the depth based lambda currently held in m_rdLambdaArray/m_sadLambdaArray
+        struct
+        {
+            bool     valid              = false;
+            uint8_t  codingType         = 0;
+            uint32_t gopRefDist         = 0;
+            uint8_t  hierarchLevelPlus1 = 0;
+            uint32_t lowDelayMode       = 0;
+        } m_lambdaKey;
+
         MHW_VDBOX_NODE_IND m_vdboxIndex = MHW_VDBOX_NODE_1;
         uint32_t           m_currRecycledBufIdx = 0;
 
@@ -441,6 +441,13 @@ namespace encode
             return eStatus;
         }
 
+        // Records of the whole lookahead window have to stay in the stats ring
+        if (m_lookaheadDepth > m_numLaDataEntry)
+        {
+            ENCODE_ASSERTMESSAGE("LookaheadDepth %d exceeds the %d lookahead records supported!", m_lookaheadDepth, m_numLaDataEntry);
+            return MOS_STATUS_INVALID_PARAMETER;
+        }
+
         m_hevcPicParams = static_cast<PCODEC_HEVC_ENCODE_PICTURE_PARAMS>(encodeParams->pPicParams);
         ENCODE_CHK_NULL_RETURN(m_hevcPicParams);
         m_nalUnitParams = encodeParams->ppNALUnitParams;
@@ -464,6 +471,10 @@ namespace encode
             m_currLaDataIdx -= 1;
             m_bLastPicFlagFirstIn = false;
         }
+        else if (!m_lastPicInStream)
+        {
+            m_laRecordCodingType[m_currLaDataIdx] = m_hevcPicParams->CodingType;
+        }
 
         return eStatus;
     }
@@ -508,6 +519,24 @@ namespace encode
                     encodeStatusMfx->lookaheadStatus.miniGopSize = m_hevcSeqParams->GopRefDist;
                 }
             }
+
+            // CPU side analysis of the reported record, runs at status query time so it
+            // overlaps with the lookahead pass of the following frames.
+            auto &lookaheadStatus = encodeStatusMfx->lookaheadStatus;
+            if (lookaheadStatus.laRecordIdx < m_numLaDataEntry)
+            {
+                bool sceneChange = false;
+                ENCODE_CHK_STATUS_RETURN(m_lplaHelper->DetectSceneChange(
+                    lookaheadStatus.laIntraCuCount,
+                    lookaheadStatus.laFrameByteCount,
+                    lookaheadStatus.laCodingType == I_TYPE,
+                    sceneChange));
+                // Only add to the hint reported by the lookahead kernel, never clear it.
+                if (m_lookaheadAdaptiveI && sceneChange)
+                {
+                    lookaheadStatus.intraHint = 1;
+                }
+            }
         }
 
         return eStatus;
@@ -760,6 +789,25 @@ namespace encode
         miCpyMemMemParams.dwDstOffset = baseOffset + CODECHAL_OFFSETOF(LookaheadReport, adaptive_rounding);
         ENCODE_CHK_STATUS_RETURN(m_miItf->MHW_ADDCMD_F(MI_COPY_MEM_MEM)(cmdBuffer));
 
+        // Lookahead pass statistics of the reported record for CPU side scene analysis
+        auto &storeDataParams            = m_miItf->MHW_GETPAR_F(MI_STORE_DATA_IMM)();
+        storeDataParams                  = {};
+        storeDataParams.pOsResource      = resource;
+        storeDataParams.dwResourceOffset = baseOffset + CODECHAL_OFFSETOF(LookaheadReport, laRecordIdx);
+        storeDataParams.dwValue          = m_offset;
+        ENCODE_CHK_STATUS_RETURN(m_miItf->MHW_ADDCMD_F(MI_STORE_DATA_IMM)(cmdBuffer));
+        // Coding type is captured with the report, the ring slot is reused by later frames before the report is queried.
+        storeDataParams.dwResourceOffset = baseOffset + CODECHAL_OFFSETOF(LookaheadReport, laCodingType);
+        storeDataParams.dwValue          = m_laRecordCodingType[m_offset];
+        ENCODE_CHK_STATUS_RETURN(m_miItf->MHW_ADDCMD_F(MI_STORE_DATA_IMM)(cmdBuffer));
+        miCpyMemMemParams.presSrc     = m_vdencLaStatsBuffer;
+        miCpyMemMemParams.dwSrcOffset = m_offset * sizeof(VdencHevcLaStats) + CODECHAL_OFFSETOF(VdencHevcLaStats, intraCuCount);
+        miCpyMemMemParams.dwDstOffset = baseOffset + CODECHAL_OFFSETOF(LookaheadReport, laIntraCuCount);
+        ENCODE_CHK_STATUS_RETURN(m_miItf->MHW_ADDCMD_F(MI_COPY_MEM_MEM)(cmdBuffer));
+        miCpyMemMemParams.dwSrcOffset = m_offset * sizeof(VdencHevcLaStats) + CODECHAL_OFFSETOF(VdencHevcLaStats, frameByteCount);
+        miCpyMemMemParams.dwDstOffset = baseOffset + CODECHAL_OFFSETOF(LookaheadReport, laFrameByteCount);
+        ENCODE_CHK_STATUS_RETURN(m_miItf->MHW_ADDCMD_F(MI_COPY_MEM_MEM)(cmdBuffer));
+
         flushDwParams = {};
         ENCODE_CHK_STATUS_RETURN(m_miItf->MHW_ADDCMD_F(MI_FLUSH_DW)(cmdBuffer));
 
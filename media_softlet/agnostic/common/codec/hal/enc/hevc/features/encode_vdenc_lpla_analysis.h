@@ -530,6 +530,7 @@ namespace encode
         uint32_t                   m_statsBuffer[600][4]                                                                       = {};
         bool                       m_useDSData = false;
         bool                       m_bLastPicFlagFirstIn                                                                       = true;
+        uint8_t                    m_laRecordCodingType[m_numLaDataEntry]                                                      = {};  //!< Coding type of each lookahead record, copied into the lookahead report at submission
 
     MEDIA_CLASS_DEFINE_END(encode__VdencLplaAnalysis)
     };
@@ -49,22 +49,6 @@ HevcVdencRoi::HevcVdencRoi(
     m_basicFeature = dynamic_cast<EncodeBasicFeature *>(m_featureManager->GetFeature(FeatureIDs::basicFeature));
     ENCODE_CHK_NULL_NO_STATUS_RETURN(m_basicFeature);
 }
-MOS_STATUS HevcVdencRoi::ClearStreaminBuffer(uint32_t lucNumber)
-{
-    // Clear streamin
-    ENCODE_CHK_NULL_RETURN(m_streamInTemp);
-
-    uint8_t *data = (uint8_t *)m_allocator->LockResourceForWrite(m_streamIn);
-    ENCODE_CHK_NULL_RETURN(data);
-
-    MOS_ZeroMemory(m_streamInTemp, lucNumber * 64);
-    MOS_SecureMemcpy(data, m_streamInSize, m_streamInTemp, m_streamInSize);
-
-    ENCODE_CHK_STATUS_RETURN(m_allocator->UnLock(m_streamIn));
-
-    return MOS_STATUS_SUCCESS;
-}
-
 MOS_STATUS HevcVdencRoi::Init(void *setting)
 {
     ENCODE_FUNC_CALL();
@@ -159,12 +143,16 @@ MOS_STATUS HevcVdencRoi::Update(void *params)
 
     if (!m_isArbRoi || (hevcPicParams->CodingType == I_TYPE && !IFrameIsSet) || ((hevcPicParams->CodingType == P_TYPE || hevcPicParams->CodingType == B_TYPE) && !PBFrameIsSet))
     {
-        m_streamInTemp = (uint8_t *)MOS_AllocMemory(m_streamInSize);
-        ENCODE_CHK_NULL_RETURN(m_streamInTemp);
+        // The overlap map writes every LCU of the stream in data, so the buffer
+        // is only zeroed once and the last frame's data can be reused.
+        if (m_streamInTemp == nullptr)
+        {
+            m_streamInTemp = (uint8_t *)MOS_AllocAndZeroMemory(m_streamInSize);
+            ENCODE_CHK_NULL_RETURN(m_streamInTemp);
+        }
 
         uint32_t lcuNumber = GetLCUNumber();
-
-        ENCODE_CHK_STATUS_RETURN(ClearStreaminBuffer(lcuNumber));
+        ENCODE_CHK_COND_RETURN(lcuNumber * CODECHAL_CACHELINE_SIZE > m_streamInSize, "Stream in buffer too small");
 
         m_roiOverlap.Update(lcuNumber);
 
@@ -186,8 +174,6 @@ MOS_STATUS HevcVdencRoi::Update(void *params)
 
         ENCODE_CHK_STATUS_RETURN(WriteStreaminData());
 
-        MOS_SafeFreeMemory(m_streamInTemp);
-
 #if (_DEBUG || _RELEASE_INTERNAL)
         ENCODE_CHK_NULL_RETURN(m_hwInterface);
         ENCODE_CHK_NULL_RETURN(m_hwInterface->GetOsInterface());
@@ -219,10 +205,15 @@ MOS_STATUS HevcVdencRoi::WriteStreaminData()
     uint8_t *streaminBuffer = (uint8_t *)m_allocator->LockResourceForWrite(m_streamIn);
     ENCODE_CHK_NULL_RETURN(streaminBuffer);
 
-    m_roiOverlap.WriteStreaminData(
-        m_strategyFactory.GetRoi(), 
-        m_strategyFactory.GetDirtyRoi(),
+    MOS_STATUS status = m_roiOverlap.WriteStreaminData(
+        m_roiEnabled ? m_strategyFactory.GetRoi() : nullptr,
+        m_dirtyRoiEnabled ? m_strategyFactory.GetDirtyRoi() : nullptr,
         m_streamInTemp);
+    if (status != MOS_STATUS_SUCCESS)
+    {
+        m_allocator->UnLock(m_streamIn);
+        return status;
+    }
 
     MOS_SecureMemcpy(streaminBuffer, m_streamInSize, m_streamInTemp, m_streamInSize);
 
@@ -44,6 +44,9 @@ public:
         PicParams *hevcPicParams,
         SlcParams *hevcSlcParams) override;
 
+    //! ROI control depends on the LCU row in the boost cycle
+    bool IsLcuIndependent() const override { return false; }
+
 protected:
     void SetRoiCtrlMode(
         uint32_t        lcuIndex,
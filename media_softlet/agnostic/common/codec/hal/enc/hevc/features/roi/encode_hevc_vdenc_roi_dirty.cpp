@@ -61,10 +61,7 @@ MOS_STATUS DirtyROI::SetupRoi(RoiOverlap &overlap)
         (MOS_ALIGN_CEIL(m_basicFeature->m_frameHeight, 64) / 32);
     int32_t  streamInNumCUs = streamInWidth * streamInHeight;
 
-    for (auto i = 0; i < streamInNumCUs; i++)
-    {
-        overlap.MarkLcu(i, RoiOverlap::mkDirtyRoiBk);
-    }
+    overlap.MarkAllLcus(streamInNumCUs, RoiOverlap::mkDirtyRoiBk);
 
     uint32_t streamInWidthNo64Align  = (MOS_ALIGN_CEIL(m_basicFeature->m_frameWidth, 32) / 32);
     uint32_t streamInHeightNo64Align = (MOS_ALIGN_CEIL(m_basicFeature->m_oriFrameHeight, 32) / 32);
@@ -389,12 +386,8 @@ void DirtyROI::StreaminSetDirtyRectRegion(
 {
     ENCODE_FUNC_CALL();
 
-    std::vector<uint32_t> lcuVector;
-    GetLCUsInRoiRegion(streamInWidth, top, bottom, left, right, lcuVector);
-
-    overlap.MarkLcus(lcuVector, cu64Align ? 
-        RoiOverlap::mkDirtyRoi : 
-        RoiOverlap::mkDirtyRoiNone64Align);
+    MarkLcusInRoiRegion(overlap, streamInWidth, top, bottom, left, right,
+        cu64Align ? RoiOverlap::mkDirtyRoi : RoiOverlap::mkDirtyRoiNone64Align);
 }
 
 void DirtyROI::StreaminSetBorderNon64AlignStaticRegion(
@@ -407,13 +400,8 @@ void DirtyROI::StreaminSetBorderNon64AlignStaticRegion(
 {
     ENCODE_FUNC_CALL();
 
-    std::vector<uint32_t> lcuVector;
-    GetLCUsInRoiRegion(streamInWidth, top, bottom, left, right, lcuVector);
-
-    for (uint32_t lcu : lcuVector)
-    {
-        overlap.MarkLcus(lcuVector, RoiOverlap::mkDirtyRoiBkNone64Align);
-    }
+    MarkLcusInRoiRegion(overlap, streamInWidth, top, bottom, left, right,
+        RoiOverlap::mkDirtyRoiBkNone64Align);
 }
 
 void DirtyROI::SetStreaminBackgroundData(
@@ -134,11 +134,8 @@ MOS_STATUS HucForceQpROI::SetupRoi(RoiOverlap &overlap)
 
 
     int32_t streamInNumCUs = streamInWidth * streamInHeight;
-    for (auto i = 0; i < streamInNumCUs; i++)
-    {
-        overlap.MarkLcu(i, cu64Align ? 
-            RoiOverlap::mkRoiBk : RoiOverlap::mkRoiBkNone64Align);
-    }
+    overlap.MarkAllLcus(streamInNumCUs, cu64Align ?
+        RoiOverlap::mkRoiBk : RoiOverlap::mkRoiBkNone64Align);
 
     return eStatus;
 }
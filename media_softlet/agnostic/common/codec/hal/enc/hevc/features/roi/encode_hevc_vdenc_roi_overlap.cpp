@@ -47,7 +47,8 @@ void RoiOverlap::Update(uint32_t lcuNumber)
     if (m_overlapMap == nullptr)
     {
         m_overlapMap = (uint16_t *)
-            MOS_AllocMemory(lcuNumber * sizeof(uint16_t));
+            MOS_AllocMemory(m_lcuNumber * sizeof(uint16_t));
+        m_lastStreaminBuffer = nullptr;
     }
 
     MOS_ZeroMemory(m_overlapMap, m_lcuNumber * sizeof(uint16_t));
@@ -102,13 +103,47 @@ void RoiOverlap::MarkLcu(uint32_t lcu, OverlapMarker marker)
     }
 }
 
-MOS_STATUS RoiOverlap::WriteStreaminData(
+void RoiOverlap::MarkAllLcus(uint32_t lcuNumber, OverlapMarker marker)
+{
+    if (m_overlapMap == nullptr)
+    {
+        return;
+    }
+
+    uint16_t data   = (marker & m_maskOverlapMarker) | (m_maskRoiRegionIndex << m_bitNumberOfOverlapMarker);
+    uint16_t *map   = m_overlapMap;
+    lcuNumber       = MOS_MIN(lcuNumber, m_lcuNumber);
+
+    // Same rules as CanWriteMark, evaluated once for the whole span.
+    if (marker == mkRoiBk || marker == mkRoiBkNone64Align)
+    {
+        for (uint32_t i = 0; i < lcuNumber; i++)
+        {
+            map[i] = map[i] ? map[i] : data;
+        }
+    }
+    else if (marker == mkRoi || marker == mkRoiNone64Align)
+    {
+        for (uint32_t i = 0; i < lcuNumber; i++)
+        {
+            map[i] = (map[i] == mkDirtyRoi || map[i] == mkDirtyRoiNone64Align) ? map[i] : data;
+        }
+    }
+    else
+    {
+        for (uint32_t i = 0; i < lcuNumber; i++)
+        {
+            map[i] = data;
+        }
+    }
+}
+
+MOS_STATUS RoiOverlap::WriteStreaminDataPerLcu(
     RoiStrategy *roi,
     RoiStrategy *dirtyRoi,
     uint8_t *streaminBuffer)
 {
-    ENCODE_CHK_NULL_RETURN(streaminBuffer);
-    ENCODE_CHK_NULL_RETURN(m_overlapMap);
+    MOS_ZeroMemory(streaminBuffer, m_lcuNumber * sizeof(StreaminRecord));
 
     for (uint32_t i = 0; i < m_lcuNumber; i++)
     {
@@ -133,4 +168,88 @@ MOS_STATUS RoiOverlap::WriteStreaminData(
     return MOS_STATUS_SUCCESS;
 }
 
-}  // namespace encode
\ No newline at end of file
+MOS_STATUS RoiOverlap::WriteStreaminData(
+    RoiStrategy *roi,
+    RoiStrategy *dirtyRoi,
+    uint8_t *streaminBuffer)
+{
+    ENCODE_CHK_NULL_RETURN(streaminBuffer);
+    ENCODE_CHK_NULL_RETURN(m_overlapMap);
+
+    if ((roi && !roi->IsLcuIndependent()) || (dirtyRoi && !dirtyRoi->IsLcuIndependent()))
+    {
+        m_lastStreaminBuffer = nullptr;
+
+        if (roi)
+        {
+            ENCODE_CHK_STATUS_RETURN(roi->BeginStreaminData());
+        }
+        MOS_STATUS status = WriteStreaminDataPerLcu(roi, dirtyRoi, streaminBuffer);
+        if (roi)
+        {
+            ENCODE_CHK_STATUS_RETURN(roi->EndStreaminData());
+        }
+        return status;
+    }
+
+    // Render each distinct label once. Labels come in long runs, so only
+    // look up the record map when the label changes.
+    std::map<uint16_t, StreaminRecord> records;
+    uint16_t lastLabel = 0;
+
+    for (uint32_t i = 0; i < m_lcuNumber; i++)
+    {
+        uint16_t label = m_overlapMap[i];
+        if (label == 0 || label == lastLabel || records.find(label) != records.end())
+        {
+            lastLabel = label;
+            continue;
+        }
+        lastLabel = label;
+
+        OverlapMarker   marker   = GetMarker(label);
+        RoiStrategy    *strategy = IsRoiMarker(marker) ? roi : (IsDirtyRoiMarker(marker) ? dirtyRoi : nullptr);
+        StreaminRecord &record   = records[label];
+        record.fill(0);
+
+        if (strategy != nullptr)
+        {
+            ENCODE_CHK_STATUS_RETURN(strategy->WriteStreaminData(
+                0, marker, GetRoiRegionIndex(label), (uint8_t *)record.data()));
+        }
+    }
+
+    if (m_lastStreaminBuffer == streaminBuffer &&
+        m_lastRecords == records &&
+        m_lastOverlapMap.size() == m_lcuNumber &&
+        memcmp(m_lastOverlapMap.data(), m_overlapMap, m_lcuNumber * sizeof(uint16_t)) == 0)
+    {
+        ENCODE_NORMALMESSAGE("ROI overlap map not changed, reuse streamin data.");
+        return MOS_STATUS_SUCCESS;
+    }
+
+    const StreaminRecord  zeroRecord = {};
+    const StreaminRecord *record     = &zeroRecord;
+    StreaminRecord       *dst        = (StreaminRecord *)streaminBuffer;
+    lastLabel                        = 0;
+
+    for (uint32_t i = 0; i < m_lcuNumber; i++)
+    {
+        uint16_t label = m_overlapMap[i];
+        if (label != lastLabel)
+        {
+            auto it   = records.find(label);
+            record    = (it == records.end()) ? &zeroRecord : &it->second;
+            lastLabel = label;
+        }
+        dst[i] = *record;
+    }
+
+    m_lastOverlapMap.assign(m_overlapMap, m_overlapMap + m_lcuNumber);
+    m_lastRecords        = std::move(records);
+    m_lastStreaminBuffer = streaminBuffer;
+
+    return MOS_STATUS_SUCCESS;
+}
+
+}  // namespace encode
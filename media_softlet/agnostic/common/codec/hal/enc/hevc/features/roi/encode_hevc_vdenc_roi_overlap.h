@@ -28,10 +28,15 @@
 #ifndef __CODECHAL_HEVC_VDENC_ROI_OVERLAP_H__
 #define __CODECHAL_HEVC_VDENC_ROI_OVERLAP_H__
 
+#include <array>
+#include <map>
+#include <vector>
+
 namespace encode
 {
 
-using UintVector = std::vector<uint32_t>;
+using UintVector     = std::vector<uint32_t>;
+using StreaminRecord = std::array<uint32_t, 16>;  //<! Raw data of one 64 bytes VDENC_STREAMIN_STATE
 
 class RoiStrategy;
 
@@ -86,7 +91,7 @@ public:
     //! \return void
     //!
     void MarkLcus(
-        const UintVector lcus, 
+        const UintVector &lcus,
         OverlapMarker marker, 
         int32_t roiRegionIndex = m_maskRoiRegionIndex)
     {
@@ -107,9 +112,39 @@ public:
     //!
     void MarkLcu(uint32_t lcu, OverlapMarker marker);
 
+    //!
+    //! \brief  mark the specific LCU with provided marker and region index
+    //!
+    //! \param  [in] lcus
+    //!         Index of LCU
+    //! \param  [in] marker
+    //!         overlap marker
+    //! \param  [in] roiRegionIndex
+    //!         Index of ROI region
+    //! \return void
+    //!
+    void MarkLcu(uint32_t lcu, OverlapMarker marker, int32_t roiRegionIndex);
+
+    //!
+    //! \brief  mark the first lcuNumber LCUs with provided marker
+    //!
+    //! \param  [in] lcuNumber
+    //!         Number of LCU to mark
+    //! \param  [in] marker
+    //!         overlap marker
+    //! \return void
+    //!
+    void MarkAllLcus(uint32_t lcuNumber, OverlapMarker marker);
+
     //!
     //! \brief  Write streamin data according to the overlap map
     //!
+    //! \detail When both strategies write the same data for all LCUs with
+    //!         the same marker and region, each distinct label of the map is
+    //!         rendered once and copied to its LCUs. If neither the map nor the
+    //!         rendered records changed since last frame, the buffer is kept.
+    //!         Every LCU of the map is written, unmarked ones with zero.
+    //!
     //! \param  [in] roi
     //!         ROI strategy
     //! \param  [in] dirtyRoi
@@ -126,17 +161,21 @@ public:
 
 private:
     //!
-    //! \brief  mark the specific LCU with provided marker and region index
+    //! \brief  Write streamin data LCU by LCU
     //!
-    //! \param  [in] lcus
-    //!         Index of LCU
-    //! \param  [in] marker
-    //!         overlap marker
-    //! \param  [in] roiRegionIndex
-    //!         Index of ROI region
-    //! \return void
+    //! \param  [in] roi
+    //!         ROI strategy
+    //! \param  [in] dirtyRoi
+    //!         Dirty ROI strategy
+    //! \param  [in, out] streaminBuffer
+    //!         streamin buffer
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
     //!
-    void MarkLcu(uint32_t lcu, OverlapMarker marker, int32_t roiRegionIndex);
+    MOS_STATUS WriteStreaminDataPerLcu(
+        RoiStrategy *roi,
+        RoiStrategy *dirtyRoi,
+        uint8_t *streaminBuffer);
 
     //!
     //! \brief  Check whether the marker can be written to the specific LCU.
@@ -201,6 +240,10 @@ private:
 
     uint32_t   m_lcuNumber  = 0;       //<! Number of LCU
 
+    std::vector<uint16_t>              m_lastOverlapMap;                //<! Overlap map of last written streamin data
+    std::map<uint16_t, StreaminRecord> m_lastRecords;                   //<! Records of last written streamin data
+    uint8_t                           *m_lastStreaminBuffer = nullptr;  //<! Buffer last written, null if not reusable
+
 protected:
     //! This map is a array of LCU description. The description is a unsigned 
     //! 16 bit integer data, In each description includes overlap marker and
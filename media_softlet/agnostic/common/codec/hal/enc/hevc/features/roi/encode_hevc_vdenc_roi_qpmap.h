@@ -45,6 +45,23 @@ namespace encode
 
         virtual ~QPMapROI() {}
 
+        //! Force QP of each LCU comes from the MB QP data surface
+        virtual bool IsLcuIndependent() const override { return false; }
+
+        //!
+        //! \brief    Lock the MB QP data surface for the whole streamin pass
+        //! \return   MOS_STATUS
+        //!           MOS_STATUS_SUCCESS if success, else fail reason
+        //!
+        virtual MOS_STATUS BeginStreaminData() override;
+
+        //!
+        //! \brief    Unlock the MB QP data surface
+        //! \return   MOS_STATUS
+        //!           MOS_STATUS_SUCCESS if success, else fail reason
+        //!
+        virtual MOS_STATUS EndStreaminData() override;
+
     protected:
         //!
         //! \brief    Set the ROI ctrol mode(Native/ForceQP/MBQPMap)
@@ -105,7 +122,7 @@ namespace encode
             uint8_t *                 rawStreamIn) override;
 
     private:
-
+        uint8_t *m_qpData = nullptr;  //!< MB QP data locked by BeginStreaminData
 
     MEDIA_CLASS_DEFINE_END(encode__QPMapROI)
     };
@@ -195,18 +195,12 @@ MOS_STATUS RoiStrategy::SetupRoi(RoiOverlap &overlap)
         uint16_t right  = (uint16_t)
             CodecHal_Clip3(0, streamInWidth, m_roiRegions[i].Right);
 
-        UintVector lcuVector;
-        GetLCUsInRoiRegion(streamInWidth, top, bottom, left, right, lcuVector);
-
-        overlap.MarkLcus(lcuVector, cu64Align ? 
-            RoiOverlap::mkRoi : RoiOverlap::mkRoiNone64Align, i);
+        MarkLcusInRoiRegion(overlap, streamInWidth, top, bottom, left, right,
+            cu64Align ? RoiOverlap::mkRoi : RoiOverlap::mkRoiNone64Align, i);
     }
 
-    for (auto i = 0; i < streamInNumCUs; i++)
-    {
-        overlap.MarkLcu(i, cu64Align ? 
-            RoiOverlap::mkRoiBk : RoiOverlap::mkRoiBkNone64Align);
-    }
+    overlap.MarkAllLcus(streamInNumCUs, cu64Align ?
+        RoiOverlap::mkRoiBk : RoiOverlap::mkRoiBkNone64Align);
 
     return eStatus;
 }
@@ -347,6 +341,11 @@ void RoiStrategy::GetLCUsInRoiRegion(
         return;
     }
 
+    if (bottom > top && right > left)
+    {
+        lcuVector.reserve(lcuVector.size() + (bottom - top) * (right - left));
+    }
+
     for (auto y = top; y < bottom; y++)
     {
         for (auto x = left; x < right; x++)
@@ -360,6 +359,36 @@ void RoiStrategy::GetLCUsInRoiRegion(
     }
 }
 
+void RoiStrategy::MarkLcusInRoiRegion(
+    RoiOverlap               &overlap,
+    uint32_t                  streamInWidth,
+    uint32_t                  top,
+    uint32_t                  bottom,
+    uint32_t                  left,
+    uint32_t                  right,
+    RoiOverlap::OverlapMarker marker,
+    int32_t                   roiRegionIndex)
+{
+    if (m_isTileModeEnabled)
+    {
+        UintVector lcuVector;
+        GetLCUsInRoiRegionForTile(streamInWidth, top, bottom, left, right, lcuVector);
+        overlap.MarkLcus(lcuVector, marker, roiRegionIndex);
+        return;
+    }
+
+    for (uint32_t y = top; y < bottom; y++)
+    {
+        // Same mapping as StreaminZigZagToLinearMap: one LCU row is a run of
+        // 2-LCU pairs, 4 entries apart inside the 64x64 zigzag order.
+        uint32_t rowBase = streamInWidth * (y & ~1u) + ((y % 2) ? 2 : 0);
+        for (uint32_t x = left; x < right; x++)
+        {
+            overlap.MarkLcu(rowBase + 2 * x - (x % 2), marker, roiRegionIndex);
+        }
+    }
+}
+
 /*******************************************************
 
     Following is for RoiStrategyFactory
@@ -275,6 +275,28 @@ public:
         uint32_t roiRegionIndex,
         uint8_t *streamInBuffer);
 
+    //!
+    //! \brief    Check whether streamin data only depends on marker and region
+    //! \return   bool
+    //!           true if all LCUs with the same marker and ROI region get the
+    //!           same streamin data, so that it can be written once per label.
+    //!
+    virtual bool IsLcuIndependent() const { return true; }
+
+    //!
+    //! \brief    Prepare for a pass of WriteStreaminData over all LCUs
+    //! \return   MOS_STATUS
+    //!           MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    virtual MOS_STATUS BeginStreaminData() { return MOS_STATUS_SUCCESS; }
+
+    //!
+    //! \brief    Finish a pass of WriteStreaminData over all LCUs
+    //! \return   MOS_STATUS
+    //!           MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    virtual MOS_STATUS EndStreaminData() { return MOS_STATUS_SUCCESS; }
+
     //!
     //! \brief    Set VDENC_PIPE_BUF_ADDR parameters
     //!
@@ -386,6 +408,38 @@ protected:
         uint32_t    right,
         UintVector &lcuVector);
 
+    //!
+    //! \brief    Mark LCUs In ROI region to overlap map
+    //! \detail   Without tiles the LCUs of one row are written directly in
+    //!           the zigzag order of the stream-in buffer, no index vector is built.
+    //! \param    [in] overlap
+    //!           Overlap between ROI and dirty ROI
+    //! \param    [in] streamInWidth
+    //!           StreamInWidth, location of top left corner
+    //! \param    [in] top
+    //!           top of the ROI region
+    //! \param    [in] bottom
+    //!           bottom of the ROI region
+    //! \param    [in] left
+    //!           left of the ROI region
+    //! \param    [in] right
+    //!           right of the ROI region
+    //! \param    [in] marker
+    //!           overlap marker
+    //! \param    [in] roiRegionIndex
+    //!           Index of ROI region, -1 if LCUs not belong to any ROI region
+    //! \return   void
+    //!
+    void MarkLcusInRoiRegion(
+        RoiOverlap               &overlap,
+        uint32_t                  streamInWidth,
+        uint32_t                  top,
+        uint32_t                  bottom,
+        uint32_t                  left,
+        uint32_t                  right,
+        RoiOverlap::OverlapMarker marker,
+        int32_t                   roiRegionIndex = -1);
+
     //!
     //! \brief    Get LCUs' index In ROI region in Tile
     //!
@@ -261,6 +261,8 @@ namespace encode
         }
         else
         {
+            RUN_FEATURE_INTERFACE_RETURN(HevcEncodeTile, HevcFeatureIDs::encodeTile, BeginPatchTileLevelBatchPool, m_pipeline->GetCurrentPass());
+
             for (uint16_t tileCol = 0; tileCol < numTileColumns; tileCol++)
             {
                 ENCODE_CHK_STATUS_RETURN(AddOneTileCommands(
@@ -269,6 +271,8 @@ namespace encode
                     tileCol,
                     m_pipeline->GetCurrentPass()));
             }
+
+            RUN_FEATURE_INTERFACE_RETURN(HevcEncodeTile, HevcFeatureIDs::encodeTile, EndPatchTileLevelBatchPool);
         }
 
         // Insert end of sequence/stream if set
@@ -738,22 +742,23 @@ namespace encode
                 cmdBuffer,
                 m_osInterface->pOsContext,
                 &tempCmdBuffer->OsResource,
-                0,
+                tileLevelBatchBuffer->dwOffset,
                 false,
-                tempCmdBuffer->iOffset);
+                tempCmdBuffer->iOffset - tileLevelBatchBuffer->dwOffset);
             HalOcaInterfaceNext::On1stLevelBBEnd(*tempCmdBuffer, *m_osInterface);
 
         #if USE_CODECHAL_DEBUG_TOOL
+            uint32_t *tileCmdBase = tempCmdBuffer->pCmdBase + tileLevelBatchBuffer->dwOffset / sizeof(uint32_t);
             if (tempCmdBuffer->pCmdPtr && tempCmdBuffer->pCmdBase &&
-                tempCmdBuffer->pCmdPtr > tempCmdBuffer->pCmdBase)
+                tempCmdBuffer->pCmdPtr > tileCmdBase)
             {
                 CodechalDebugInterface *debugInterface = m_pipeline->GetDebugInterface();
                 std::string             name("TileLevelBatchBuffer");
                 name += "Row" + std::to_string(tileRow) + "Col" + std::to_string(tileCol);
 
                 ENCODE_CHK_STATUS_RETURN(debugInterface->DumpData(
-                    tempCmdBuffer->pCmdBase,
-                    (uint32_t)(4 * (tempCmdBuffer->pCmdPtr - tempCmdBuffer->pCmdBase)),
+                    tileCmdBase,
+                    (uint32_t)(4 * (tempCmdBuffer->pCmdPtr - tileCmdBase)),
                     CodechalDbgAttr::attrCmdBufferMfx,
                     name.c_str()));
             }
@@ -783,6 +788,8 @@ namespace encode
         uint16_t numTileRows    = 1;
         RUN_FEATURE_INTERFACE_RETURN(HevcEncodeTile, HevcFeatureIDs::encodeTile, GetTileRowColumns, numTileRows, numTileColumns);
 
+        RUN_FEATURE_INTERFACE_RETURN(HevcEncodeTile, HevcFeatureIDs::encodeTile, BeginPatchTileLevelBatchPool, m_pipeline->GetCurrentPass());
+
         for (uint32_t tileRow = 0; tileRow < numTileRows; tileRow++)
         {
             uint32_t Pass = m_pipeline->GetCurrentPass();
@@ -796,6 +803,8 @@ namespace encode
             }
         }
 
+        RUN_FEATURE_INTERFACE_RETURN(HevcEncodeTile, HevcFeatureIDs::encodeTile, EndPatchTileLevelBatchPool);
+
         if(m_pipeline->IsLastPipe())
         {
             // increment the 3rd lvl bb to break successive frames dependency
@@ -22,6 +22,7 @@
 
 #include "bitstream_writer.h"
 #include <assert.h>
+#include <stdint.h>
 
 BitstreamWriter::BitstreamWriter(mfxU8 *bs, mfxU32 size, mfxU8 bitOffset)
     : m_bsStart(bs), m_bsEnd(bs + size), m_bs(bs), m_bitStart(bitOffset & 7), m_bitOffset(bitOffset & 7), m_codILow(0)  // cabac variables
@@ -67,39 +68,50 @@ void BitstreamWriter::Reset(mfxU8 *bs, mfxU32 size, mfxU8 bitOffset)
 void BitstreamWriter::PutBitsBuffer(mfxU32 n, void *bb, mfxU32 o)
 {}
 
-void BitstreamWriter::PutBits(mfxU32 n, mfxU32 b)
+void BitstreamWriter::PutBitsAt(mfxU8 *&bs, mfxU8 &bitOffset, mfxU32 n, mfxU32 b)
 {
-    assert(n <= sizeof(b) * 8);
-    while (n > 24)
+    assert(n <= sizeof(b) * 8 && bitOffset < 8);
+    if (!n)
     {
-        n -= 16;
-        PutBits(16, (b >> n));
+        return;
     }
 
-    b <<= (32 - n);
+    mfxU32   total = bitOffset + n;
+    uint64_t word  = (uint64_t)(bs[0] & (0xFF00 >> bitOffset)) << 56;
+
+    word |= ((uint64_t)b << (64 - n)) >> bitOffset;
 
-    if (!m_bitOffset)
+    // store big-endian, total is at most 39 bits
+    for (mfxU32 i = 0; i < ((total + 7) >> 3); i++)
     {
-        m_bs[0] = (mfxU8)(b >> 24);
-        m_bs[1] = (mfxU8)(b >> 16);
+        bs[i] = (mfxU8)(word >> (56 - 8 * i));
     }
-    else
-    {
-        b >>= m_bitOffset;
-        n += m_bitOffset;
 
-        m_bs[0] |= (mfxU8)(b >> 24);
-        m_bs[1] = (mfxU8)(b >> 16);
-    }
+    bs += (total >> 3);
+    bitOffset = (mfxU8)(total & 7);
+}
 
-    if (n > 16)
+void BitstreamWriter::PutGolombAt(mfxU8 *&bs, mfxU8 &bitOffset, mfxU32 b)
+{
+    mfxU32 code = b + 1;
+    mfxU32 len  = 32 - BsCountLeadingZeros(code);
+
+    // len - 1 leading zeros followed by code, the zeros come for free
+    // from the width of the field when the whole code fits one word
+    if (2 * len - 1 <= 32)
+    {
+        PutBitsAt(bs, bitOffset, 2 * len - 1, code);
+    }
+    else
     {
-        m_bs[2] = (mfxU8)(b >> 8);
-        m_bs[3] = (mfxU8)b;
+        PutBitsAt(bs, bitOffset, len - 1, 0);
+        PutBitsAt(bs, bitOffset, len, code);
     }
+}
 
-    m_bs += (n >> 3);
-    m_bitOffset = (n & 7);
+void BitstreamWriter::PutBits(mfxU32 n, mfxU32 b)
+{
+    PutBitsAt(m_bs, m_bitOffset, n, b);
 }
 
 void BitstreamWriter::PutBit(mfxU32 b)
@@ -125,22 +137,7 @@ void BitstreamWriter::PutBit(mfxU32 b)
 
 void BitstreamWriter::PutGolomb(mfxU32 b)
 {
-    if (!b)
-    {
-        PutBit(1);
-    }
-    else
-    {
-        mfxU32 n = 1;
-
-        b++;
-
-        while (b >> n)
-            n++;
-
-        PutBits(n - 1, 0);
-        PutBits(n, b);
-    }
+    PutGolombAt(m_bs, m_bitOffset, b);
 }
 
 void BitstreamWriter::PutTrailingBits(bool bCheckAligened)
@@ -122,6 +122,24 @@ const mfxU8 tab_cabacTransTbl[2][128] =
     }
 };
 
+//!
+//! \brief    Count leading zero bits of a non-zero 32-bit value
+//!
+inline mfxU32 BsCountLeadingZeros(mfxU32 v)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return (mfxU32)__builtin_clz(v);
+#else
+    mfxU32 n = 0;
+    while (!(v & 0x80000000))
+    {
+        v <<= 1;
+        n++;
+    }
+    return n;
+#endif
+}
+
 class IBsWriter
 {
 public:
@@ -147,6 +165,30 @@ public:
     void         PutGolomb(mfxU32 b);
     void         PutTrailingBits(bool bCheckAligned = false);
 
+    //!
+    //! \brief    Write up to 32 bits at a bit position of a byte buffer
+    //! \details  The new code is merged with the bits already in the partial byte
+    //!           in one 64-bit word and all touched bytes are stored at once, so
+    //!           callers keeping their own byte pointer and bit offset share the
+    //!           same writer as BitstreamWriter.
+    //! \param    bs
+    //!           [in/out] current byte, advanced past the completed bytes
+    //! \param    bitOffset
+    //!           [in/out] bits already used in the current byte, [0, 8)
+    //! \param    n
+    //!           [in] number of bits, [0, 32]
+    //! \param    b
+    //!           [in] code, only the n low bits are written
+    //!
+    static void PutBitsAt(mfxU8 *&bs, mfxU8 &bitOffset, mfxU32 n, mfxU32 b);
+
+    //!
+    //! \brief    Write an unsigned Exp-Golomb code at a bit position of a byte buffer
+    //! \details  The code length comes from a leading zero count and codes up to
+    //!           32 bits long are written with a single PutBitsAt.
+    //!
+    static void PutGolombAt(mfxU8 *&bs, mfxU8 &bitOffset, mfxU32 b);
+
     virtual void PutUE(mfxU32 b) override { PutGolomb(b); }
     virtual void PutSE(mfxI32 b) override { (b > 0) ? PutGolomb((b << 1) - 1) : PutGolomb((-b) << 1); }
 
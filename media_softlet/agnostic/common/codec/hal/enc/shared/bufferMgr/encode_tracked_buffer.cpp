@@ -55,8 +55,8 @@ TrackedBuffer::~TrackedBuffer()
         (*it)->Reset();
         MOS_Delete(*it);
     }
-    m_bufferQueue.clear();
-    m_oldQueue.clear();
+    m_bufferQueue.fill(nullptr);
+    m_oldQueue.fill(nullptr);
 
     MosUtilities::MosDestroyMutex(m_mutex);
 }
@@ -199,18 +199,11 @@ MOS_STATUS TrackedBuffer::Release(CODEC_REF_LIST* refList)
         m_condition.Signal();
     }
 
-    if (!m_oldQueue.empty())
+    for (auto &queue : m_oldQueue)
     {
-        for (auto iter = m_oldQueue.begin(); iter != m_oldQueue.end();)
+        if (queue != nullptr && queue->SafeToDestory())
         {
-            if (iter->second->SafeToDestory())
-            {
-                iter = m_oldQueue.erase(iter);
-            }
-            else
-            {
-                iter++;
-            }
+            queue = nullptr;
         }
     }
 
@@ -219,25 +212,18 @@ MOS_STATUS TrackedBuffer::Release(CODEC_REF_LIST* refList)
 
 MOS_STATUS TrackedBuffer::OnSizeChange()
 {
-    for (auto iter = m_bufferQueue.begin(); iter != m_bufferQueue.end();)
+    // Keep every queue as a candidate instead of freeing it right away, GetBufferQueue
+    // takes it back when the parameter registered for the new size still fits.
+    // Queues which are not taken back are freed in Release once all buffers return.
+    for (uint32_t i = 0; i < m_bufferTypeNum; i++)
     {
-        if (iter->second->SafeToDestory())
-        {
-            iter = m_bufferQueue.erase(iter);
-        }
-        else
+        if (m_bufferQueue[i] != nullptr)
         {
-            iter++;
+            m_oldQueue[i] = std::move(m_bufferQueue[i]);
+            m_bufferQueue[i] = nullptr;
         }
     }
 
-    if (!m_bufferQueue.empty())
-    {
-        m_oldQueue.insert(std::make_move_iterator(m_bufferQueue.begin()),
-            std::make_move_iterator(m_bufferQueue.end()));
-        m_bufferQueue.clear();
-    }
-
     return MOS_STATUS_SUCCESS;
 }
 
@@ -266,26 +252,37 @@ MOS_RESOURCE *TrackedBuffer::GetBuffer(BufferType type, uint32_t index)
 
 std::shared_ptr<BufferQueue> TrackedBuffer::GetBufferQueue(BufferType type)
 {
-    auto iter = m_bufferQueue.find(type);
-    if (iter == m_bufferQueue.end())
+    uint32_t index = static_cast<uint32_t>(type);
+    if (index >= m_bufferTypeNum)
     {
-        auto param = m_allocParams.find(type);
-        if (param == m_allocParams.end())
-        {
-            return nullptr;
-        }
+        return nullptr;
+    }
 
-        ResourceType resType = GetResourceType(type);
+    if (m_bufferQueue[index] != nullptr)
+    {
+        return m_bufferQueue[index];
+    }
 
-        auto alloc = std::make_shared<BufferQueue>(m_allocator, param->second, m_maxSlotCnt);
-        alloc->SetResourceType(resType);
-        m_bufferQueue.insert(std::make_pair(type, alloc));
-        return alloc;
+    auto param = m_allocParams.find(type);
+    if (param == m_allocParams.end())
+    {
+        return nullptr;
     }
-    else
+
+    // reuse the queue retired by the last size change if its resources still fit
+    if (m_oldQueue[index] != nullptr && m_oldQueue[index]->IsReusable(param->second))
     {
-        return iter->second;
+        m_bufferQueue[index] = std::move(m_oldQueue[index]);
+        m_oldQueue[index]    = nullptr;
+        return m_bufferQueue[index];
     }
+
+    ResourceType resType = GetResourceType(type);
+
+    auto alloc = std::make_shared<BufferQueue>(m_allocator, param->second, m_maxSlotCnt);
+    alloc->SetResourceType(resType);
+    m_bufferQueue[index] = alloc;
+    return alloc;
 }
 
 }
\ No newline at end of file
@@ -37,6 +37,7 @@
 #include "mos_os.h"
 #include "mos_os_specific.h"
 #include <stdint.h>
+#include <array>
 #include <map>
 #include <memory>
 #include <vector>
@@ -70,6 +71,7 @@ enum class BufferType
     preencRef0,
     preencRef1,
     AlignedRawSurface,
+    numOfBufferType,
 };
 
 struct MapBufferResourceType
@@ -146,6 +148,8 @@ public:
     //!
     //! \brief  It must be invoked when resolution changes, it will release
     //!         internal buffers on demand
+    //! \details The retired queues are kept as candidates, a queue whose resources
+    //!          can serve the parameter registered for the new size is reused in place
     //! \return MOS_STATUS
     //!         MOS_STATUS_SUCCESS if success, else fail reason
     //!
@@ -246,8 +250,11 @@ protected:
     std::vector<BufferSlot *> m_bufferSlots = {};          //!< buffer slots
 
     std::map<BufferType, MOS_ALLOC_GFXRES_PARAMS>       m_allocParams = {};  //!< allocate parameters
-    std::map<BufferType, std::shared_ptr<BufferQueue> > m_bufferQueue = {};  //!< buffer queues
-    std::map<BufferType, std::shared_ptr<BufferQueue> > m_oldQueue = {};     //!< old queues for resolution change
+
+    static constexpr uint32_t m_bufferTypeNum = static_cast<uint32_t>(BufferType::numOfBufferType);
+
+    std::array<std::shared_ptr<BufferQueue>, m_bufferTypeNum> m_bufferQueue = {};  //!< buffer queues indexed by buffer type
+    std::array<std::shared_ptr<BufferQueue>, m_bufferTypeNum> m_oldQueue    = {};  //!< old queues for resolution change
 
 MEDIA_CLASS_DEFINE_END(encode__TrackedBuffer)
 };
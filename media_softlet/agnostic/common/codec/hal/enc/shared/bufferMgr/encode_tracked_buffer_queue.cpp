@@ -110,6 +110,30 @@ bool BufferQueue::SafeToDestory()
     return m_resourcePool.size() == m_resources.size();
 }
 
+bool BufferQueue::IsReusable(const MOS_ALLOC_GFXRES_PARAMS &param)
+{
+    if (param.Type != m_allocParam.Type ||
+        param.Format != m_allocParam.Format ||
+        param.TileType != m_allocParam.TileType ||
+        param.bIsCompressible != m_allocParam.bIsCompressible ||
+        param.CompressionMode != m_allocParam.CompressionMode ||
+        param.dwMemType != m_allocParam.dwMemType ||
+        param.ResUsageType != m_allocParam.ResUsageType)
+    {
+        return false;
+    }
+
+    if (m_resourceType == ResourceType::bufferResource && param.Type == MOS_GFXRES_BUFFER)
+    {
+        // linear buffers are only addressed up to the size programmed by the caller
+        return param.dwBytes <= m_allocParam.dwBytes && param.dwBytes >= (m_allocParam.dwBytes >> 2);
+    }
+
+    return param.dwWidth == m_allocParam.dwWidth &&
+           param.dwHeight == m_allocParam.dwHeight &&
+           param.dwDepth == m_allocParam.dwDepth &&
+           param.dwArraySize == m_allocParam.dwArraySize;
+}
 
 void *BufferQueue::AllocateResource()
 {
@@ -89,6 +89,17 @@ public:
 
     void SetResourceType(ResourceType resType);
 
+    //!
+    //! \brief  Check whether the resources of the queue can serve a new allocate parameter
+    //! \details Buffers are reused when the new size fits and does not waste more than
+    //!          3/4 of the allocation, surfaces only when their layout is unchanged
+    //! \param  [in] param
+    //!         reference to the new MOS_ALLOC_GFXRES_PARAMS
+    //! \return bool
+    //!         true if the queue can be kept for the new parameter
+    //!
+    bool IsReusable(const MOS_ALLOC_GFXRES_PARAMS &param);
+
 protected:
     //!
     //! \brief  Allocate resource
@@ -0,0 +1,168 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     encode_const_table_registry.cpp
+//! \brief    Process wide registry of read-only encode constant tables
+//!
+
+#include "encode_const_table_registry.h"
+#include "encode_utils.h"
+#include "codec_def_common.h"
+
+namespace encode
+{
+bool EncodeConstTableRegistry::Key::operator<(const Key &other) const
+{
+    if (device != other.device)
+    {
+        return device < other.device;
+    }
+    if (platform != other.platform)
+    {
+        return platform < other.platform;
+    }
+    if (codec != other.codec)
+    {
+        return codec < other.codec;
+    }
+    if (targetUsage != other.targetUsage)
+    {
+        return targetUsage < other.targetUsage;
+    }
+    return variant < other.variant;
+}
+
+EncodeConstTableRegistry &EncodeConstTableRegistry::GetInstance()
+{
+    static EncodeConstTableRegistry registry;
+    return registry;
+}
+
+MOS_STATUS EncodeConstTableRegistry::GetKey(PMOS_INTERFACE osInterface, uint32_t codec, uint32_t targetUsage, uint32_t variant, Key &key)
+{
+    ENCODE_CHK_NULL_RETURN(osInterface);
+    ENCODE_CHK_NULL_RETURN(osInterface->pfnGetPlatform);
+
+    PLATFORM platform = {};
+    osInterface->pfnGetPlatform(osInterface, &platform);
+
+    key.device = (osInterface->osStreamState && osInterface->osStreamState->osDeviceContext) ?
+        (const void *)osInterface->osStreamState->osDeviceContext : (const void *)osInterface;
+    key.platform    = (uint32_t)platform.eProductFamily;
+    key.codec       = codec;
+    key.targetUsage = targetUsage;
+    key.variant     = variant;
+
+    return MOS_STATUS_SUCCESS;
+}
+
+PMOS_RESOURCE EncodeConstTableRegistry::Acquire(PMOS_INTERFACE osInterface, const Key &key, uint32_t size, const char *name, const FillFunc &fill)
+{
+    ENCODE_FUNC_CALL();
+
+    if (osInterface == nullptr || size == 0 || !fill)
+    {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_tables.find(key);
+    if (it != m_tables.end())
+    {
+        if (it->second.size < size)
+        {
+            ENCODE_ASSERTMESSAGE("Const table %s registered with a smaller size.", name);
+            return nullptr;
+        }
+        it->second.refCount++;
+        return &it->second.resource;
+    }
+
+    MOS_ALLOC_GFXRES_PARAMS allocParams;
+    MOS_ZeroMemory(&allocParams, sizeof(allocParams));
+    allocParams.Type         = MOS_GFXRES_BUFFER;
+    allocParams.TileType     = MOS_TILE_LINEAR;
+    allocParams.Format       = Format_Buffer;
+    allocParams.dwBytes      = MOS_ALIGN_CEIL(size, CODECHAL_PAGE_SIZE);
+    allocParams.pBufName     = name;
+    allocParams.ResUsageType = MOS_HW_RESOURCE_USAGE_ENCODE_INTERNAL_READ;
+
+    Table table;
+    if (osInterface->pfnAllocateResource(osInterface, &allocParams, &table.resource) != MOS_STATUS_SUCCESS)
+    {
+        return nullptr;
+    }
+
+    MOS_LOCK_PARAMS lockFlags;
+    MOS_ZeroMemory(&lockFlags, sizeof(lockFlags));
+    lockFlags.WriteOnly = 1;
+
+    MOS_STATUS status = MOS_STATUS_NULL_POINTER;
+    void      *data   = osInterface->pfnLockResource(osInterface, &table.resource, &lockFlags);
+    if (data)
+    {
+        MOS_ZeroMemory(data, allocParams.dwBytes);
+        status = fill(data);
+        osInterface->pfnUnlockResource(osInterface, &table.resource);
+    }
+
+    if (status != MOS_STATUS_SUCCESS)
+    {
+        osInterface->pfnFreeResource(osInterface, &table.resource);
+        return nullptr;
+    }
+
+    table.size     = allocParams.dwBytes;
+    table.refCount = 1;
+
+    auto inserted = m_tables.emplace(key, table);
+    return &inserted.first->second.resource;
+}
+
+void EncodeConstTableRegistry::Release(PMOS_INTERFACE osInterface, PMOS_RESOURCE resource)
+{
+    ENCODE_FUNC_CALL();
+
+    if (osInterface == nullptr || resource == nullptr)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    for (auto it = m_tables.begin(); it != m_tables.end(); it++)
+    {
+        if (&it->second.resource != resource)
+        {
+            continue;
+        }
+
+        if (--it->second.refCount == 0)
+        {
+            osInterface->pfnFreeResource(osInterface, &it->second.resource);
+            m_tables.erase(it);
+        }
+        return;
+    }
+}
+}  // namespace encode
@@ -0,0 +1,131 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     encode_const_table_registry.h
+//! \brief    Process wide registry of read-only encode constant tables
+//! \details  Constant tables uploaded for HuC (BRC constant data and similar) only
+//!           depend on the platform, the codec and a small table variant, so all
+//!           sessions opened on one device can read the same GPU buffer instead of
+//!           each allocating and filling its own copy.
+//!
+
+#ifndef __ENCODE_CONST_TABLE_REGISTRY_H__
+#define __ENCODE_CONST_TABLE_REGISTRY_H__
+
+#include <functional>
+#include <map>
+#include <mutex>
+#include "mos_os.h"
+#include "media_class_trace.h"
+
+namespace encode
+{
+class EncodeConstTableRegistry
+{
+public:
+    struct Key
+    {
+        const void *device      = nullptr;  //!< device the sessions share GPU buffers on
+        uint32_t    platform    = 0;        //!< PRODUCT_FAMILY
+        uint32_t    codec       = 0;        //!< CODECHAL_MODE of the table user
+        uint32_t    targetUsage = 0;        //!< 0 if the table does not depend on TU
+        uint32_t    variant     = 0;        //!< table variant (frame type, feature flags)
+
+        bool operator<(const Key &other) const;
+    };
+
+    //!
+    //! \brief    Callback filling a newly allocated table
+    //! \param    data
+    //!           [out] locked table memory, zeroed
+    //!
+    using FillFunc = std::function<MOS_STATUS(void *data)>;
+
+    static EncodeConstTableRegistry &GetInstance();
+
+    //!
+    //! \brief    Build the registry key of a table
+    //! \details  Tables are only shared between sessions of the same device, sessions
+    //!           without a device context get a key of their own.
+    //! \param    osInterface
+    //!           [in] OS interface of the session
+    //! \param    codec
+    //!           [in] CODECHAL_MODE of the table user
+    //! \param    targetUsage
+    //!           [in] target usage, 0 if the table does not depend on it
+    //! \param    variant
+    //!           [in] table variant
+    //! \param    key
+    //!           [out] registry key
+    //! \return   MOS_STATUS
+    //!           MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    static MOS_STATUS GetKey(PMOS_INTERFACE osInterface, uint32_t codec, uint32_t targetUsage, uint32_t variant, Key &key);
+
+    //!
+    //! \brief    Get a reference to a table, building it on first use
+    //! \param    osInterface
+    //!           [in] OS interface of the session
+    //! \param    key
+    //!           [in] registry key
+    //! \param    size
+    //!           [in] table size in bytes
+    //! \param    name
+    //!           [in] buffer name
+    //! \param    fill
+    //!           [in] callback writing the table content, only called when the
+    //!           table is not in the registry yet
+    //! \return   PMOS_RESOURCE
+    //!           read-only table buffer, nullptr if failed
+    //!
+    PMOS_RESOURCE Acquire(PMOS_INTERFACE osInterface, const Key &key, uint32_t size, const char *name, const FillFunc &fill);
+
+    //!
+    //! \brief    Drop a reference taken by Acquire
+    //! \details  The buffer is freed with the given OS interface when its last
+    //!           reference is dropped.
+    //! \param    osInterface
+    //!           [in] OS interface of the session
+    //! \param    resource
+    //!           [in] table buffer returned by Acquire
+    //! \return   void
+    //!
+    void Release(PMOS_INTERFACE osInterface, PMOS_RESOURCE resource);
+
+protected:
+    struct Table
+    {
+        MOS_RESOURCE resource = {};
+        uint32_t     size     = 0;
+        uint32_t     refCount = 0;
+    };
+
+    EncodeConstTableRegistry() = default;
+
+    std::map<Key, Table> m_tables;
+    std::mutex           m_mutex;
+
+MEDIA_CLASS_DEFINE_END(encode__EncodeConstTableRegistry)
+};
+}  // namespace encode
+
+#endif  // __ENCODE_CONST_TABLE_REGISTRY_H__
@@ -108,4 +108,45 @@ namespace encode
         return MOS_STATUS_SUCCESS;
     }
 
+    MOS_STATUS EncodeLPLA::DetectSceneChange(
+        uint32_t intraCuCount,
+        uint32_t frameByteCount,
+        bool     isIntra,
+        bool    &sceneChange)
+    {
+        ENCODE_FUNC_CALL();
+
+        sceneChange = false;
+
+        if (isIntra)
+        {
+            // Intra frames do not tell anything about temporal correlation, restart
+            // the scene average from the next inter frame.
+            m_sceneFrameNum = 0;
+            return MOS_STATUS_SUCCESS;
+        }
+
+        if (m_sceneFrameNum >= m_sceneMinFrames &&
+            (uint64_t)intraCuCount > (uint64_t)m_sceneIntraCuCount * m_sceneIntraFactor &&
+            (uint64_t)frameByteCount > (uint64_t)m_sceneFrameByteCount * m_sceneSizeFactor)
+        {
+            sceneChange     = true;
+            m_sceneFrameNum = 0;
+        }
+
+        if (m_sceneFrameNum == 0)
+        {
+            m_sceneIntraCuCount   = intraCuCount;
+            m_sceneFrameByteCount = frameByteCount;
+        }
+        else
+        {
+            m_sceneIntraCuCount   = (uint32_t)((int64_t)m_sceneIntraCuCount + ((int64_t)intraCuCount - (int64_t)m_sceneIntraCuCount) / (1 << m_sceneAvgShift));
+            m_sceneFrameByteCount = (uint32_t)((int64_t)m_sceneFrameByteCount + ((int64_t)frameByteCount - (int64_t)m_sceneFrameByteCount) / (1 << m_sceneAvgShift));
+        }
+        m_sceneFrameNum++;
+
+        return MOS_STATUS_SUCCESS;
+    }
+
 } // encode
@@ -103,6 +103,38 @@ namespace encode
             uint8_t  &DeltaQP,
             uint32_t &prevQpModulationStrength);
 
+        //!
+        //! \brief  Detect scene change from lookahead statistics
+        //! \details Compares the intra CU count and the coded size of a lookahead
+        //!          record against the running average of the current scene.
+        //!          Records must be fed in display order.
+        //! \param  [in] intraCuCount
+        //!         Normalized intra CU count of the record
+        //! \param  [in] frameByteCount
+        //!         Coded frame size of the record in bytes
+        //! \param  [in] isIntra
+        //!         Flag to indicate the record was coded as intra frame
+        //! \param  [out] sceneChange
+        //!         Flag to indicate the record starts a new scene
+        //! \return MOS_STATUS
+        //!         MOS_STATUS_SUCCESS if success, else fail reason
+        //!
+        MOS_STATUS DetectSceneChange(
+            uint32_t intraCuCount,
+            uint32_t frameByteCount,
+            bool     isIntra,
+            bool    &sceneChange);
+
+    protected:
+        static constexpr uint32_t m_sceneMinFrames   = 2;  //!< Inter frames averaged before a scene change can be detected
+        static constexpr uint32_t m_sceneAvgShift    = 2;  //!< Moving average weight of 1/4 for new records
+        static constexpr uint32_t m_sceneIntraFactor = 3;  //!< Intra CU count ratio against the scene average for a scene change
+        static constexpr uint32_t m_sceneSizeFactor  = 2;  //!< Frame size ratio against the scene average for a scene change
+
+        uint32_t m_sceneIntraCuCount   = 0;  //!< Average intra CU count of the current scene
+        uint32_t m_sceneFrameByteCount = 0;  //!< Average frame byte count of the current scene
+        uint32_t m_sceneFrameNum       = 0;  //!< Number of inter frames averaged in the current scene
+
     MEDIA_CLASS_DEFINE_END(encode__EncodeLPLA)
     };
 } // encode
@@ -333,16 +333,37 @@ namespace encode
 
         m_tileRowPass = tileRowPass;
 
-        uint8_t *data = (uint8_t *)m_allocator->LockResourceForWrite(
-            &(m_tileLevelBatchBuffer[m_tileBatchBufferIndex][m_tileRowPass][m_tileIdx].OsResource));
+        PMHW_BATCH_BUFFER tileLevelBatchBuffer = &m_tileLevelBatchBuffer[m_tileBatchBufferIndex][m_tileRowPass][m_tileIdx];
+        PMHW_BATCH_BUFFER pool                 = &m_tileLevelBatchPool[m_tileBatchBufferIndex][m_tileRowPass];
+
+        uint8_t *data = nullptr;
+        if (m_openTileLevelBatchPool == pool)
+        {
+            // Map the pool on the first tile only, packets recording the tiles inline never map it
+            if (m_mappedTileLevelBatchPool != pool)
+            {
+                m_tileLevelBatchPoolData = (uint8_t *)m_allocator->LockResourceForWrite(&(pool->OsResource));
+                ENCODE_CHK_NULL_RETURN(m_tileLevelBatchPoolData);
+                m_mappedTileLevelBatchPool = pool;
+            }
+            data = m_tileLevelBatchPoolData;
+        }
+        else
+        {
+            data = (uint8_t *)m_allocator->LockResourceForWrite(&(tileLevelBatchBuffer->OsResource));
+        }
         ENCODE_CHK_NULL_RETURN(data);
 
-        m_tileLevelBatchBuffer[m_tileBatchBufferIndex][m_tileRowPass][m_tileIdx].pData = data;
+        // Offsets are from the start of the allocation shared by all tiles, so that patch list
+        // entries and MI_BATCH_BUFFER_END of this tile land in its own slice
+        tileLevelBatchBuffer->pData = data;
 
         MOS_ZeroMemory(&cmdBuffer, sizeof(cmdBuffer));
-        cmdBuffer.pCmdBase = cmdBuffer.pCmdPtr = (uint32_t *)data;
-        cmdBuffer.iRemaining                   = m_tileLevelBatchSize;
-        cmdBuffer.OsResource                   = m_tileLevelBatchBuffer[m_tileBatchBufferIndex][m_tileRowPass][m_tileIdx].OsResource;
+        cmdBuffer.pCmdBase   = (uint32_t *)data;
+        cmdBuffer.iOffset    = tileLevelBatchBuffer->dwOffset;
+        cmdBuffer.pCmdPtr    = cmdBuffer.pCmdBase + cmdBuffer.iOffset / sizeof(uint32_t);
+        cmdBuffer.iRemaining = m_tileLevelBatchSize;
+        cmdBuffer.OsResource = tileLevelBatchBuffer->OsResource;
 
         return MOS_STATUS_SUCCESS;
     }
@@ -351,10 +372,52 @@ namespace encode
     {
         ENCODE_FUNC_CALL();
 
-        ENCODE_CHK_STATUS_RETURN(m_allocator->UnLock(
-            &(m_tileLevelBatchBuffer[m_tileBatchBufferIndex][m_tileRowPass][m_tileIdx].OsResource)));
+        PMHW_BATCH_BUFFER tileLevelBatchBuffer = &m_tileLevelBatchBuffer[m_tileBatchBufferIndex][m_tileRowPass][m_tileIdx];
+
+        if (m_mappedTileLevelBatchPool != &m_tileLevelBatchPool[m_tileBatchBufferIndex][m_tileRowPass])
+        {
+            ENCODE_CHK_STATUS_RETURN(m_allocator->UnLock(&(tileLevelBatchBuffer->OsResource)));
+        }
 
-        m_tileLevelBatchBuffer[m_tileBatchBufferIndex][m_tileRowPass][m_tileIdx].pData = nullptr;
+        tileLevelBatchBuffer->pData = nullptr;
+
+        return MOS_STATUS_SUCCESS;
+    }
+
+    MOS_STATUS EncodeTile::BeginPatchTileLevelBatchPool(uint32_t tileRowPass)
+    {
+        ENCODE_FUNC_CALL();
+
+        if (!m_enabled)
+        {
+            return MOS_STATUS_SUCCESS;
+        }
+        ENCODE_CHK_COND_RETURN(tileRowPass >= EncodeBasicFeature::m_vdencBrcPassNum, "Invalid tile row pass!");
+
+        // A pool left mapped by a failed frame must not be reused
+        ENCODE_CHK_STATUS_RETURN(EndPatchTileLevelBatchPool());
+
+        m_openTileLevelBatchPool = &m_tileLevelBatchPool[m_tileBatchBufferIndex][tileRowPass];
+
+        return MOS_STATUS_SUCCESS;
+    }
+
+    MOS_STATUS EncodeTile::EndPatchTileLevelBatchPool()
+    {
+        ENCODE_FUNC_CALL();
+
+        m_openTileLevelBatchPool = nullptr;
+
+        if (m_mappedTileLevelBatchPool == nullptr)
+        {
+            return MOS_STATUS_SUCCESS;
+        }
+        ENCODE_CHK_NULL_RETURN(m_allocator);
+
+        PMHW_BATCH_BUFFER pool     = m_mappedTileLevelBatchPool;
+        m_mappedTileLevelBatchPool = nullptr;
+        m_tileLevelBatchPoolData   = nullptr;
+        ENCODE_CHK_STATUS_RETURN(m_allocator->UnLock(&(pool->OsResource)));
 
         return MOS_STATUS_SUCCESS;
     }
@@ -395,17 +458,25 @@ namespace encode
                 }
             }
 
-            // Allocate the batch buffer for each tile
-            uint32_t i = 0;
-            for (i = 0; i < m_numTiles; i++)
+            // Allocate one batch buffer for all tiles, each tile owns a slice of it so that
+            // the tile batches of a pass can be patched under a single lock
+            PMHW_BATCH_BUFFER pool = &m_tileLevelBatchPool[m_tileBatchBufferIndex][idx];
+            MOS_ZeroMemory(pool, sizeof(MHW_BATCH_BUFFER));
+            pool->bSecondLevel = true;
+            ENCODE_CHK_STATUS_RETURN(Mhw_AllocateBb(
+                m_hwInterface->GetOsInterface(),
+                pool,
+                nullptr,
+                m_tileLevelBatchSize,
+                m_numTiles));
+
+            for (uint32_t i = 0; i < m_numTiles; i++)
             {
-                MOS_ZeroMemory(&m_tileLevelBatchBuffer[m_tileBatchBufferIndex][idx][i], sizeof(MHW_BATCH_BUFFER));
-                m_tileLevelBatchBuffer[m_tileBatchBufferIndex][idx][i].bSecondLevel = true;
-                ENCODE_CHK_STATUS_RETURN(Mhw_AllocateBb(
-                    m_hwInterface->GetOsInterface(),
-                    &m_tileLevelBatchBuffer[m_tileBatchBufferIndex][idx][i],
-                    nullptr,
-                    m_tileLevelBatchSize));
+                PMHW_BATCH_BUFFER tileLevelBatchBuffer = &m_tileLevelBatchBuffer[m_tileBatchBufferIndex][idx][i];
+                *tileLevelBatchBuffer            = *pool;
+                tileLevelBatchBuffer->count      = 1;
+                tileLevelBatchBuffer->dwOffset   = i * (uint32_t)pool->iSize;
+                tileLevelBatchBuffer->iRemaining = pool->iSize;
             }
         }
 
@@ -421,19 +492,17 @@ namespace encode
 
         MOS_STATUS eStatus = MOS_STATUS_SUCCESS;
 
-        // Free the batch buffer for each tile
+        EndPatchTileLevelBatchPool();
+
+        // Free the batch buffer shared by all tiles
         uint32_t i = 0;
-        uint32_t j = 0;
         for(int idx = 0; idx < m_codecHalNumTileLevelBatchBuffers; idx++)
         {
             for (i = 0; i < EncodeBasicFeature::m_vdencBrcPassNum; i++)
             {
-                if (m_hwInterface != nullptr)
+                if (m_hwInterface != nullptr && m_numTileBatchAllocated[idx] > 0)
                 {
-                    for (j = 0; j < m_numTileBatchAllocated[idx]; j++)
-                    {
-                        ENCODE_CHK_STATUS_RETURN(Mhw_FreeBb(m_hwInterface->GetOsInterface(), &m_tileLevelBatchBuffer[idx][i][j], nullptr));
-                    }
+                    ENCODE_CHK_STATUS_RETURN(Mhw_FreeBb(m_hwInterface->GetOsInterface(), &m_tileLevelBatchPool[idx][i], nullptr));
                 }
 
                 MOS_FreeMemory(m_tileLevelBatchBuffer[idx][i]);
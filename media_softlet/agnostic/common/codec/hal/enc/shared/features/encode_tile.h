@@ -244,6 +244,27 @@ public:
     //!
     virtual MOS_STATUS EndPatchTileLevelBatch();
 
+    //!
+    //! \brief  Start patching the tile level batch buffers of all tiles in a tile row pass
+    //! \details The batch buffers of all tiles are slices of one allocation. Between this
+    //!          call and EndPatchTileLevelBatchPool, the first BeginPatchTileLevelBatch maps
+    //!          the allocation and the following ones only hand out the slice of their tile
+    //!          instead of locking per tile. Nothing is mapped when no tile level batch is
+    //!          patched. Must be paired with EndPatchTileLevelBatchPool before submission.
+    //! \param  [in] tileRowPass
+    //!         Tile row pass of the tiles to be patched
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    virtual MOS_STATUS BeginPatchTileLevelBatchPool(uint32_t tileRowPass);
+
+    //!
+    //! \brief  Unmap the tile level batch buffers mapped by BeginPatchTileLevelBatchPool
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    virtual MOS_STATUS EndPatchTileLevelBatchPool();
+
     //!
     //! \brief  Get tile Level Batch Buffer from Encode Tile features
     //! \param  [in] tileRowPass
@@ -515,6 +536,10 @@ protected:
     uint32_t          m_numTileBatchAllocated[m_codecHalNumTileLevelBatchBuffers] ={0};    //!< The number of allocated batch buffer for tiles
     uint32_t          m_tileBatchBufferIndex = 0;     //!< Current index for tile batch buffer of same frame, updated per frame
     PMHW_BATCH_BUFFER m_tileLevelBatchBuffer[m_codecHalNumTileLevelBatchBuffers][EncodeBasicFeature::m_vdencBrcPassNum] = {{0}};  //!< Tile level batch buffer for each tile
+    MHW_BATCH_BUFFER  m_tileLevelBatchPool[m_codecHalNumTileLevelBatchBuffers][EncodeBasicFeature::m_vdencBrcPassNum] = {};  //!< One allocation sliced into the tile level batch buffers of all tiles
+    PMHW_BATCH_BUFFER m_openTileLevelBatchPool   = nullptr;  //!< Tile level batch pool opened by BeginPatchTileLevelBatchPool
+    PMHW_BATCH_BUFFER m_mappedTileLevelBatchPool = nullptr;  //!< Tile level batch pool currently mapped
+    uint8_t          *m_tileLevelBatchPoolData   = nullptr;  //!< Mapped data of m_mappedTileLevelBatchPool
     MOS_RESOURCE      m_resTileBasedStatisticsBuffer[EncodeBasicFeature::m_uncompressedSurfaceNum] = {};
     MOS_RESOURCE      m_resHuCPakAggregatedFrameStatsBuffer = {};
     MOS_RESOURCE      m_tileRecordBuffer[EncodeBasicFeature::m_uncompressedSurfaceNum] = {};
@@ -26,10 +26,12 @@ set(TMP_SOURCES_
     ${CMAKE_CURRENT_LIST_DIR}/encode_lpla.cpp
     ${CMAKE_CURRENT_LIST_DIR}/encode_preenc_basic_feature.cpp
     ${CMAKE_CURRENT_LIST_DIR}/encode_preenc_const_settings.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/encode_const_table_registry.cpp
 )
 
 set(TMP_HEADERS_
     ${CMAKE_CURRENT_LIST_DIR}/encode_const_settings.h
+    ${CMAKE_CURRENT_LIST_DIR}/encode_const_table_registry.h
     ${CMAKE_CURRENT_LIST_DIR}/encode_tile.h
     ${CMAKE_CURRENT_LIST_DIR}/encode_basic_feature.h
     ${CMAKE_CURRENT_LIST_DIR}/encode_feature_manager.h
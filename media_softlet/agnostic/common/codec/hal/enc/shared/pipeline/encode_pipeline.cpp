@@ -102,6 +102,13 @@ MOS_STATUS EncodePipeline::Initialize(void *settings)
         MediaUserSetting::Group::Sequence);
     m_singleTaskPhaseSupported = outValue.Get<bool>();
 
+    ReadUserSetting(
+        m_userSettingPtr,
+        outValue,
+        "Encode PreEnc Submit Ahead",
+        MediaUserSetting::Group::Sequence);
+    m_preEncSubmitAhead = outValue.Get<bool>();
+
     ENCODE_CHK_STATUS_RETURN(CreateFeatureManager());
     ENCODE_CHK_NULL_RETURN(m_featureManager);
 
@@ -370,4 +377,21 @@ void EncodePipeline::SetFrameTrackingForMultiTaskPhase()
     }
 }
 
+void EncodePipeline::SetPreEncSubmitAhead()
+{
+    // A separate submission on a multi-pipe context would leave the other pipes empty
+    if (!m_preEncSubmitAhead || !IsSingleTaskPhaseSupported() || GetPipeNum() > 1 || m_activePacketList.empty())
+    {
+        return;
+    }
+
+    // Flush the pre-encode pass as soon as it is composed so that it runs on the
+    // VDBox while the packets of the full encode are still being built. It stays
+    // on the same GPU context, which orders it before the full encode reading its
+    // output. The frame is tracked by the last submission as in multi task phase.
+    PacketProperty &prop        = m_activePacketList.back();
+    prop.immediateSubmit        = true;
+    prop.frameTrackingRequested = false;
+}
+
 }
@@ -106,6 +106,14 @@ public:
     //!
     void SetFrameTrackingForMultiTaskPhase();
 
+    //!
+    //! \brief  Submit the pre-encode packet just activated ahead of the full encode
+    //! \details Only takes effect in single task phase, where the pre-encode pass
+    //!          would otherwise wait for the whole frame command buffer
+    //! \return void
+    //!
+    void SetPreEncSubmitAhead();
+
     enum ComponentPacketIds
     {
         PACKET_COMPONENT_COMMON = 0,
@@ -345,6 +353,7 @@ protected:
 
     bool m_singleTaskPhaseSupported      = true;
     bool m_singleTaskPhaseSupportedInPak = false;
+    bool m_preEncSubmitAhead             = true;   //!< Submit pre-encode pass before composing the full encode
 
     uint32_t m_recycledBufStatusNum[CODECHAL_ENCODE_RECYCLED_BUFFER_NUM] = {0};  //!< Recycled buffer status num list
 
@@ -100,6 +100,13 @@ MOS_STATUS EncodePipeline::InitUserSetting(MediaUserSettingSharedPtr userSetting
         int32_t(1),
         false);
 
+    DeclareUserSettingKey(
+        userSettingPtr,
+        "Encode PreEnc Submit Ahead",
+        MediaUserSetting::Group::Sequence,
+        int32_t(1),
+        false);
+
     DeclareUserSettingKey(
         userSettingPtr,
         "Enable Frame Tracking",
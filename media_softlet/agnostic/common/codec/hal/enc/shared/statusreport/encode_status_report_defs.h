@@ -307,7 +307,11 @@ struct LookaheadReport
     uint8_t  adaptive_rounding = 0;
     uint8_t  miniGopSize = 0;
     uint8_t  reserved1[2];
-    uint32_t reserved3[10];
+    uint32_t laRecordIdx      = 0;  //!< Driver internal, lookahead record index the report belongs to
+    uint32_t laIntraCuCount   = 0;  //!< Driver internal, normalized intra CU count of the record in lookahead pass
+    uint32_t laFrameByteCount = 0;  //!< Driver internal, frame byte count of the record in lookahead pass
+    uint32_t laCodingType     = 0;  //!< Driver internal, coding type of the record
+    uint32_t reserved3[6];
 };
 
 // the tile size record is streamed out serving 2 purposes
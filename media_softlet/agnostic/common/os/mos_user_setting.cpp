@@ -434,6 +434,13 @@ MOS_STATUS MosUserSetting::InitMosCommonUserSetting(MediaUserSettingSharedPtr us
         1,
         true); //"Enable texture pooling in media driver."
 
+    DeclareUserSettingKey(
+        userSettingPtr,
+        __MEDIA_USER_FEATURE_ENABLE_MCPY_ADAPTIVE_ENGINE,
+        MediaUserSetting::Group::Device,
+        0,
+        true); //"Select media copy engine from measured per-engine cost."
+
     return MOS_STATUS_SUCCESS;
 }
 
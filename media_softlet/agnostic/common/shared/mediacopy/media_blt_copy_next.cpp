@@ -847,6 +847,7 @@ MOS_STATUS BltStateNext::SubmitCMD(
     MediaPerfProfiler* perfProfiler = MediaPerfProfiler::Instance();
     BLT_CHK_NULL_RETURN(perfProfiler);
     BLT_CHK_STATUS_RETURN(perfProfiler->AddPerfCollectStartCmd((void*)this, m_osInterface, m_miItf, &cmdBuffer));
+    BLT_CHK_STATUS_RETURN(AddTimestampCmd(&cmdBuffer, m_timestampStartOffset));
 
     if (pBltStateParam->bCopyMainSurface)
     {
@@ -907,6 +908,7 @@ MOS_STATUS BltStateNext::SubmitCMD(
 
          }
     }
+    BLT_CHK_STATUS_RETURN(AddTimestampCmd(&cmdBuffer, m_timestampEndOffset));
     BLT_CHK_STATUS_RETURN(perfProfiler->AddPerfCollectEndCmd((void*)this, m_osInterface, m_miItf, &cmdBuffer));
 
     // Add flush DW
@@ -1016,6 +1018,26 @@ int BltStateNext::GetPlaneNum(MOS_FORMAT format)
    return planeNum;
  }
 
+MOS_STATUS BltStateNext::AddTimestampCmd(PMOS_COMMAND_BUFFER cmdBuffer, uint32_t offset)
+{
+    if (m_timestampResource == nullptr)
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+    BLT_CHK_NULL_RETURN(cmdBuffer);
+    BLT_CHK_NULL_RETURN(m_miItf);
+
+    auto& flushDwParams             = m_miItf->MHW_GETPAR_F(MI_FLUSH_DW)();
+    flushDwParams                   = {};
+    flushDwParams.pOsResource       = m_timestampResource;
+    flushDwParams.dwResourceOffset  = offset;
+    flushDwParams.postSyncOperation = MHW_FLUSH_WRITE_TIMESTAMP_REG;
+    flushDwParams.bQWordEnable      = 1;
+    BLT_CHK_STATUS_RETURN(m_miItf->MHW_ADDCMD_F(MI_FLUSH_DW)(cmdBuffer));
+
+    return MOS_STATUS_SUCCESS;
+}
+
 MOS_STATUS BltStateNext::SetPrologParamsforCmdbuffer(PMOS_COMMAND_BUFFER cmdBuffer)
 {
    PMOS_INTERFACE                  pOsInterface;
@@ -138,6 +138,25 @@ public:
     //!
     int GetBytesPerTexelScaling(MOS_FORMAT format);
 
+    //!
+    //! \brief    Set copy timestamp target
+    //! \details  Following copies write the GPU timestamp before and after their
+    //!           commands to the given resource, null resource stops it.
+    //! \param    resource
+    //!           [in] Pointer to timestamp buffer
+    //! \param    startOffset
+    //!           [in] offset of start timestamp, qword aligned
+    //! \param    endOffset
+    //!           [in] offset of end timestamp, qword aligned
+    //! \return   void
+    //!
+    void SetTimestampTarget(PMOS_RESOURCE resource, uint32_t startOffset, uint32_t endOffset)
+    {
+        m_timestampResource    = resource;
+        m_timestampStartOffset = startOffset;
+        m_timestampEndOffset   = endOffset;
+    }
+
     //!
     //! \brief    Get plane number
     //! \details  Get plane number
@@ -308,6 +327,18 @@ protected:
     MOS_STATUS BlockCopyBuffer(
         PBLT_STATE_PARAM pBltStateParam);
 
+    //!
+    //! \brief    Add timestamp command
+    //! \details  Write the GPU timestamp to the timestamp target, nothing if no target is set.
+    //! \param    cmdBuffer
+    //!           [in] Pointer to command buffer
+    //! \param    offset
+    //!           [in] offset in timestamp target
+    //! \return   MOS_STATUS
+    //!           Return MOS_STATUS_SUCCESS if successful, otherwise failed
+    //!
+    MOS_STATUS AddTimestampCmd(PMOS_COMMAND_BUFFER cmdBuffer, uint32_t offset);
+
     //!
     //! \brief    SetPrologParamsforCmdbuffer
     //! \details  Set PrologParams for Cmdbuffer
@@ -335,6 +366,9 @@ protected:
     uint32_t     auxSize     = 0;
     void*        pMainSurface = nullptr;
     void*        pAuxSurface  = nullptr;
+    PMOS_RESOURCE m_timestampResource    = nullptr;
+    uint32_t      m_timestampStartOffset = 0;
+    uint32_t      m_timestampEndOffset   = 0;
 
     MEDIA_CLASS_DEFINE_END(BltStateNext)
 };
@@ -27,6 +27,7 @@
 
 #include "media_copy.h"
 #include "media_copy_common.h"
+#include "media_copy_cost_model.h"
 #include "media_debug_dumper.h"
 #include "mhw_cp_interface.h"
 #include "mos_utilities.h"
@@ -50,6 +51,8 @@ MediaCopyBaseState::MediaCopyBaseState():
 
 MediaCopyBaseState::~MediaCopyBaseState()
 {
+    MOS_Delete(m_costModel);
+
     if (m_osInterface)
     {
         m_osInterface->pfnDestroy(m_osInterface, false);
@@ -90,6 +93,26 @@ MOS_STATUS MediaCopyBaseState::Initialize(PMOS_INTERFACE osInterface)
     Mos_SetVirtualEngineSupported(m_osInterface, true);
     m_osInterface->pfnVirtualEngineSupported(m_osInterface, true, true);
 
+    if (m_costModel == nullptr)
+    {
+        bool enableAdaptiveEngine = false;
+        ReadUserSetting(
+            m_osInterface->pfnGetUserSettingInstance(m_osInterface),
+            enableAdaptiveEngine,
+            __MEDIA_USER_FEATURE_ENABLE_MCPY_ADAPTIVE_ENGINE,
+            MediaUserSetting::Group::Device);
+        if (enableAdaptiveEngine && IsCopyTimestampSupported())
+        {
+            m_costModel = MOS_New(MediaCopyCostModel, m_osInterface);
+            MCPY_CHK_NULL_RETURN(m_costModel);
+            if (m_costModel->Initialize() != MOS_STATUS_SUCCESS)
+            {
+                MCPY_NORMALMESSAGE("copy timestamps unavailable, adaptive engine select is off");
+                MOS_Delete(m_costModel);
+            }
+        }
+    }
+
 #if (_DEBUG || _RELEASE_INTERNAL)
     if (m_surfaceDumper == nullptr)
     {
@@ -234,6 +257,111 @@ MOS_STATUS MediaCopyBaseState::CopyEnigneSelect(MCPY_METHOD& preferMethod, MCPY_
     return MOS_STATUS_SUCCESS;
 }
 
+void MediaCopyBaseState::AdaptiveEngineSelect(
+    MCPY_STATE_PARAMS &mcpySrc,
+    MCPY_STATE_PARAMS &mcpyDst,
+    const MOS_SURFACE &src,
+    const MOS_SURFACE &dst,
+    MCPY_METHOD        preferMethod,
+    MCPY_ENGINE_CAPS  &caps,
+    MCPY_ENGINE       &mcpyEngine)
+{
+    // only re-route copies where the caller left the engine choice to the driver.
+    if (m_costModel == nullptr ||
+        (preferMethod != MCPY_METHOD_DEFAULT && preferMethod != MCPY_METHOD_PERFORMANCE))
+    {
+        return;
+    }
+#if (_DEBUG || _RELEASE_INTERNAL)
+    if (MCPY_METHOD_DEFAULT != m_MCPYForceMode)
+    {
+        return;
+    }
+#endif
+
+    MCPY_ENGINE_CAPS candidates = caps;
+    // Blt engine does not support protection.
+    if (mcpySrc.CpMode == MCPY_CPMODE_CP && mcpyDst.CpMode == MCPY_CPMODE_CLEAR && !m_allowCPBltCopy)
+    {
+        candidates.engineBlt = false;
+    }
+    candidates.engineVebox  = candidates.engineVebox && IsEngineSizeCapable(src, MCPY_ENGINE_VEBOX) && IsEngineSizeCapable(dst, MCPY_ENGINE_VEBOX);
+    candidates.engineBlt    = candidates.engineBlt && IsEngineSizeCapable(src, MCPY_ENGINE_BLT) && IsEngineSizeCapable(dst, MCPY_ENGINE_BLT);
+    candidates.engineRender = candidates.engineRender && IsEngineSizeCapable(src, MCPY_ENGINE_RENDER) && IsEngineSizeCapable(dst, MCPY_ENGINE_RENDER);
+
+    MosUtilities::MosLockMutex(m_inUseGPUMutex);
+    m_costModel->Update();
+    if (m_costModel->SelectEngine(GetCopyCostBucket(mcpySrc, mcpyDst), candidates, mcpyEngine))
+    {
+        MCPY_NORMALMESSAGE("adaptive engine select moves copy to engine %d", mcpyEngine);
+    }
+    MosUtilities::MosUnlockMutex(m_inUseGPUMutex);
+}
+
+bool MediaCopyBaseState::BeginTimedCopy(MCPY_ENGINE mcpyEngine)
+{
+    PMOS_RESOURCE resource    = nullptr;
+    uint32_t      startOffset = 0;
+    uint32_t      endOffset   = 0;
+
+    if (m_costModel == nullptr ||
+        !m_costModel->GetTimestampTarget(mcpyEngine, resource, startOffset, endOffset))
+    {
+        return false;
+    }
+
+    return SetCopyTimestamp(mcpyEngine, resource, startOffset, endOffset);
+}
+
+void MediaCopyBaseState::EndTimedCopy(MCPY_ENGINE mcpyEngine, uint32_t bucket, bool submitted)
+{
+    SetCopyTimestamp(mcpyEngine, nullptr, 0, 0);
+    if (submitted)
+    {
+        m_costModel->RecordSubmit(mcpyEngine, bucket);
+    }
+}
+
+uint32_t MediaCopyBaseState::GetCopyCostBucket(MCPY_STATE_PARAMS &mcpySrc, MCPY_STATE_PARAMS &mcpyDst)
+{
+    uint64_t size = 0;
+    if (mcpySrc.OsRes && mcpySrc.OsRes->pGmmResInfo)
+    {
+        size = mcpySrc.OsRes->pGmmResInfo->GetSizeMainSurface();
+    }
+
+    bool tiled      = mcpySrc.TileMode != MOS_TILE_LINEAR || mcpyDst.TileMode != MOS_TILE_LINEAR;
+    bool compressed = mcpySrc.CompressionMode != MOS_MMC_DISABLED || mcpyDst.CompressionMode != MOS_MMC_DISABLED;
+
+    return MediaCopyCostModel::GetBucket(size, tiled, compressed);
+}
+
+bool MediaCopyBaseState::IsEngineSizeCapable(const MOS_SURFACE &res, MCPY_ENGINE method)
+{
+    if (res.TileType != MOS_TILE_LINEAR)
+    {
+        return true;
+    }
+
+    switch (method)
+    {
+    case MCPY_ENGINE_BLT:
+        return res.dwPitch <= BLT_MAX_PITCH && res.dwHeight <= BLT_MAX_HEIGHT && res.dwWidth <= BLT_MAX_WIDTH;
+    case MCPY_ENGINE_RENDER:
+        return res.dwHeight >= RENDER_MIN_HEIGHT && res.dwWidth >= RENDER_MIN_WIDTH;
+    case MCPY_ENGINE_VEBOX:
+#if (_DEBUG || _RELEASE_INTERNAL)
+        if (m_enableVeCopySmallRes)
+        {
+            return true;
+        }
+#endif
+        return res.dwHeight >= VE_MIN_HEIGHT && res.dwWidth >= VE_MIN_WIDTH;
+    default:
+        return false;
+    }
+}
+
 uint32_t GetMinRequiredSurfaceSizeInBytes(uint32_t pitch, uint32_t height, MOS_FORMAT format)
 {
     uint32_t nBytes = 0;
@@ -445,6 +573,8 @@ MOS_STATUS MediaCopyBaseState::SurfaceCopy(PMOS_RESOURCE src, PMOS_RESOURCE dst,
 
     CopyEnigneSelect(preferMethod, mcpyEngine, mcpyEngineCaps);
 
+    AdaptiveEngineSelect(mcpySrc, mcpyDst, SrcResDetails, DstResDetails, preferMethod, mcpyEngineCaps, mcpyEngine);
+
     MCPY_CHK_STATUS_RETURN(ValidateResource(SrcResDetails, DstResDetails, mcpyEngine));
 
     MCPY_CHK_STATUS_RETURN(TaskDispatch(mcpySrc, mcpyDst, mcpyEngine));
@@ -491,6 +621,7 @@ MOS_STATUS MediaCopyBaseState::TaskDispatch(MCPY_STATE_PARAMS mcpySrc, MCPY_STAT
 #endif
 
     MosUtilities::MosLockMutex(m_inUseGPUMutex);
+    bool timed = BeginTimedCopy(mcpyEngine);
     switch(mcpyEngine)
     {
         case MCPY_ENGINE_VEBOX:
@@ -503,6 +634,10 @@ MOS_STATUS MediaCopyBaseState::TaskDispatch(MCPY_STATE_PARAMS mcpySrc, MCPY_STAT
                 eStatus = m_osInterface->pfnDecompResource(m_osInterface, mcpyDst.OsRes);
                 if (MOS_STATUS_SUCCESS != eStatus)
                 {
+                    if (timed)
+                    {
+                        EndTimedCopy(mcpyEngine, 0, false);
+                    }
                     MosUtilities::MosUnlockMutex(m_inUseGPUMutex);
                     MCPY_CHK_STATUS_RETURN(eStatus);
                 }
@@ -515,6 +650,10 @@ MOS_STATUS MediaCopyBaseState::TaskDispatch(MCPY_STATE_PARAMS mcpySrc, MCPY_STAT
         default:
             break;
     }
+    if (timed)
+    {
+        EndTimedCopy(mcpyEngine, GetCopyCostBucket(mcpySrc, mcpyDst), eStatus == MOS_STATUS_SUCCESS);
+    }
     MosUtilities::MosUnlockMutex(m_inUseGPUMutex);
 
 #if (_DEBUG || _RELEASE_INTERNAL)
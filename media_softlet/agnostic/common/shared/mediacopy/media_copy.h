@@ -38,6 +38,7 @@
 #include "mos_interface.h"
 
 class CommonSurfaceDumper;
+class MediaCopyCostModel;
 
 typedef struct _MCPY_ENGINE_CAPS
 {
@@ -290,6 +291,104 @@ protected:
     virtual MOS_STATUS MediaVeboxCopy(PMOS_RESOURCE src, PMOS_RESOURCE dst)
     {return MOS_STATUS_SUCCESS;}
 
+    //!
+    //! \brief    copy timestamp support.
+    //! \details  vebox and blt copies can write GPU timestamps around their commands,
+    //!           needed by adaptive engine selection.
+    //! \return   bool
+    //!           Return true if support, otherwise return false.
+    //!
+    virtual bool IsCopyTimestampSupported()
+    {return false;}
+
+    //!
+    //! \brief    set where the next copy on an engine writes its GPU timestamps.
+    //! \param    mcpyEngine
+    //!           [in] copy engine
+    //! \param    resource
+    //!           [in] Pointer to timestamp buffer, nullptr stops writing timestamps
+    //! \param    startOffset
+    //!           [in] offset of start timestamp
+    //! \param    endOffset
+    //!           [in] offset of end timestamp
+    //! \return   bool
+    //!           Return true if the engine copy writes the timestamps, otherwise return false.
+    //!
+    virtual bool SetCopyTimestamp(MCPY_ENGINE mcpyEngine, PMOS_RESOURCE resource, uint32_t startOffset, uint32_t endOffset)
+    {return false;}
+
+    //!
+    //! \brief    adaptive copy engine select.
+    //! \details  re-select the copy engine from the measured per-engine cost when
+    //!           the caller leaves the choice to the driver (default or performance
+    //!           method), so copies move off an engine saturated by other work.
+    //! \param    mcpySrc
+    //!           [in] source paramters
+    //! \param    mcpyDst
+    //!           [in] destination paramters
+    //! \param    src
+    //!           [in] source surface details
+    //! \param    dst
+    //!           [in] destination surface details
+    //! \param    preferMethod
+    //!           [in] copy method
+    //! \param    caps
+    //!           [in] reference of featue supported engine's caps
+    //! \param    mcpyEngine
+    //!           [in/out] static engine choice on input, selected engine on output
+    //! \return   void
+    //!
+    virtual void AdaptiveEngineSelect(
+        MCPY_STATE_PARAMS &mcpySrc,
+        MCPY_STATE_PARAMS &mcpyDst,
+        const MOS_SURFACE &src,
+        const MOS_SURFACE &dst,
+        MCPY_METHOD        preferMethod,
+        MCPY_ENGINE_CAPS  &caps,
+        MCPY_ENGINE       &mcpyEngine);
+
+    //!
+    //! \brief    get cost model bucket of a copy.
+    //! \param    mcpySrc
+    //!           [in] source paramters
+    //! \param    mcpyDst
+    //!           [in] destination paramters
+    //! \return   uint32_t
+    //!           bucket index keyed by copy size, tiling and compression.
+    //!
+    uint32_t GetCopyCostBucket(MCPY_STATE_PARAMS &mcpySrc, MCPY_STATE_PARAMS &mcpyDst);
+
+    //!
+    //! \brief    start timing a copy for the cost model.
+    //! \details  must be called with m_inUseGPUMutex held, right before the engine copy.
+    //! \param    mcpyEngine
+    //!           [in] copy engine
+    //! \return   bool
+    //!           Return true if the copy writes timestamps and EndTimedCopy must follow.
+    //!
+    bool BeginTimedCopy(MCPY_ENGINE mcpyEngine);
+
+    //!
+    //! \brief    finish timing a copy for the cost model.
+    //! \param    mcpyEngine
+    //!           [in] copy engine
+    //! \param    bucket
+    //!           [in] cost bucket of the copy
+    //! \param    submitted
+    //!           [in] whether the engine copy was submitted
+    //! \return   void
+    //!
+    void EndTimedCopy(MCPY_ENGINE mcpyEngine, uint32_t bucket, bool submitted);
+
+    //!
+    //! \brief    quiet check of the engine size limits.
+    //! \details  same limits as CheckResourceSizeValidForCopy without error reporting,
+    //!           used to filter candidate engines.
+    //! \return   bool
+    //!           Return true if the engine can copy the surface, otherwise return false.
+    //!
+    bool IsEngineSizeCapable(const MOS_SURFACE &res, MCPY_ENGINE method);
+
     MOS_STATUS CheckResourceSizeValidForCopy(const MOS_SURFACE &res, const MCPY_ENGINE method);
     MOS_STATUS ValidateResource(const MOS_SURFACE &src, const MOS_SURFACE &dst, MCPY_ENGINE method);
 
@@ -299,6 +398,7 @@ public:
 
 protected:
     PMOS_MUTEX           m_inUseGPUMutex        = nullptr; // Mutex for in-use GPU context
+    MediaCopyCostModel  *m_costModel           = nullptr; // measured engine cost, null if adaptive selection is off
 #if (_DEBUG || _RELEASE_INTERNAL)
     CommonSurfaceDumper *m_surfaceDumper        = nullptr;
     int                  m_MCPYForceMode        = 0;
@@ -0,0 +1,271 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     media_copy_cost_model.cpp
+//! \brief    Measured per-engine cost model used by media copy engine selection
+//! \details  Each timed copy writes the GPU timestamp before and after its
+//!           commands into its own slot of a mapped buffer. The slot is read once
+//!           the GPU status sync tag of the context shows the copy retired, so a
+//!           sample is the engine time of the copy itself, independent of when the
+//!           driver polls.
+//!
+
+#include "media_copy_cost_model.h"
+#include "media_copy_common.h"
+#include "mos_utilities.h"
+
+MediaCopyCostModel::MediaCopyCostModel(PMOS_INTERFACE osInterface) :
+    m_osInterface(osInterface)
+{
+}
+
+MediaCopyCostModel::~MediaCopyCostModel()
+{
+    if (m_osInterface && !Mos_ResourceIsNull(&m_timestampBuffer))
+    {
+        if (m_timestamps)
+        {
+            m_osInterface->pfnUnlockResource(m_osInterface, &m_timestampBuffer);
+            m_timestamps = nullptr;
+        }
+        m_osInterface->pfnFreeResource(m_osInterface, &m_timestampBuffer);
+    }
+}
+
+MOS_STATUS MediaCopyCostModel::Initialize()
+{
+    MCPY_CHK_NULL_RETURN(m_osInterface);
+
+    m_frequency = m_osInterface->pfnGetTsFrequency(m_osInterface);
+    if (m_frequency == 0)
+    {
+        return MOS_STATUS_UNIMPLEMENTED;
+    }
+
+    MOS_ALLOC_GFXRES_PARAMS allocParams;
+    MOS_ZeroMemory(&allocParams, sizeof(MOS_ALLOC_GFXRES_PARAMS));
+    allocParams.Type     = MOS_GFXRES_BUFFER;
+    allocParams.TileType = MOS_TILE_LINEAR;
+    allocParams.Format   = Format_Buffer;
+    allocParams.dwBytes  = sizeof(CopyTimestamp) * MCPY_COST_ENGINE_NUM * MCPY_COST_MAX_PENDING;
+    allocParams.pBufName = "MediaCopyTimestamp";
+
+    MCPY_CHK_STATUS_RETURN(m_osInterface->pfnAllocateResource(m_osInterface, &allocParams, &m_timestampBuffer));
+
+    // Kept mapped for the lifetime of the model, slots are only read after their copy retired.
+    MOS_LOCK_PARAMS lockFlags;
+    MOS_ZeroMemory(&lockFlags, sizeof(MOS_LOCK_PARAMS));
+    lockFlags.ReadOnly = 1;
+    m_timestamps = (volatile CopyTimestamp *)m_osInterface->pfnLockResource(m_osInterface, &m_timestampBuffer, &lockFlags);
+    MCPY_CHK_NULL_RETURN(m_timestamps);
+
+    return MOS_STATUS_SUCCESS;
+}
+
+uint32_t MediaCopyCostModel::GetBucket(uint64_t size, bool tiled, bool compressed)
+{
+    uint32_t sizeClass = 0;
+    uint64_t limit     = 256 * 1024;
+
+    while (sizeClass < MCPY_COST_SIZE_CLASS_NUM - 1 && size >= limit)
+    {
+        sizeClass++;
+        limit <<= 2;
+    }
+
+    return (sizeClass << 2) | (tiled ? 2 : 0) | (compressed ? 1 : 0);
+}
+
+uint64_t MediaCopyCostModel::GetTimeUs(uint64_t ticks)
+{
+    return m_frequency ? (ticks * 1000000 / m_frequency) : 0;
+}
+
+void MediaCopyCostModel::AddSample(uint32_t engine, uint32_t bucket, uint64_t latencyUs)
+{
+    EngineCost &cost = m_cost[bucket][engine];
+
+    if (cost.sampleCount == 0)
+    {
+        cost.avgLatencyUs = latencyUs;
+    }
+    else
+    {
+        int64_t delta     = (int64_t)latencyUs - (int64_t)cost.avgLatencyUs;
+        cost.avgLatencyUs = (uint64_t)((int64_t)cost.avgLatencyUs + delta / (1 << MCPY_COST_EWMA_SHIFT));
+    }
+
+    if (cost.sampleCount < 0xffffffff)
+    {
+        cost.sampleCount++;
+    }
+}
+
+void MediaCopyCostModel::Update()
+{
+    if (m_osInterface == nullptr || m_timestamps == nullptr)
+    {
+        return;
+    }
+
+    for (uint32_t engine = 0; engine < MCPY_COST_ENGINE_NUM; engine++)
+    {
+        // Copies on one engine retire in submission order, stop at the first one still running.
+        while (m_pendingCount[engine] > 0)
+        {
+            PendingCopy &pending = m_pending[engine][m_pendingHead[engine]];
+            uint32_t     syncTag = m_osInterface->pfnGetGpuStatusSyncTag(m_osInterface, pending.gpuContext);
+
+            if ((int32_t)(syncTag - pending.tag) < 0)
+            {
+                break;
+            }
+
+            volatile CopyTimestamp &timestamp = m_timestamps[engine * MCPY_COST_MAX_PENDING + m_pendingHead[engine]];
+            uint64_t                start     = timestamp.start;
+            uint64_t                end       = timestamp.end;
+            // Skip a wrapped timestamp counter.
+            if (end > start)
+            {
+                AddSample(engine, pending.bucket, GetTimeUs(end - start));
+            }
+
+            m_pendingHead[engine] = (m_pendingHead[engine] + 1) % MCPY_COST_MAX_PENDING;
+            m_pendingCount[engine]--;
+        }
+    }
+}
+
+bool MediaCopyCostModel::SelectEngine(uint32_t bucket, const MCPY_ENGINE_CAPS &caps, MCPY_ENGINE &mcpyEngine)
+{
+    if (bucket >= MCPY_COST_BUCKET_NUM || m_timestamps == nullptr)
+    {
+        return false;
+    }
+
+    // Render copies never get samples, so they are left to the static policy.
+    const bool allowed[MCPY_COST_ENGINE_NUM] = {
+        caps.engineVebox != 0,
+        caps.engineBlt != 0,
+        false};
+
+    MCPY_ENGINE staticEngine = mcpyEngine;
+    uint32_t    copyCount    = ++m_copyCount[bucket];
+
+    // Probe an engine with too few (or stale) samples while it is idle, so the model
+    // keeps learning engines the static policy would never pick.
+    if (copyCount % MCPY_COST_EXPLORE_PERIOD == 0)
+    {
+        for (uint32_t engine = 0; engine < MCPY_COST_ENGINE_NUM; engine++)
+        {
+            if (allowed[engine] && engine != (uint32_t)staticEngine &&
+                m_pendingCount[engine] == 0 &&
+                m_cost[bucket][engine].sampleCount < MCPY_COST_MIN_SAMPLES * (copyCount / MCPY_COST_EXPLORE_PERIOD))
+            {
+                mcpyEngine = (MCPY_ENGINE)engine;
+                return true;
+            }
+        }
+    }
+
+    if (!allowed[staticEngine] || m_cost[bucket][staticEngine].sampleCount < MCPY_COST_MIN_SAMPLES)
+    {
+        return false;
+    }
+
+    uint64_t bestCost = m_cost[bucket][staticEngine].avgLatencyUs * (m_pendingCount[staticEngine] + 1);
+    for (uint32_t engine = 0; engine < MCPY_COST_ENGINE_NUM; engine++)
+    {
+        if (!allowed[engine] || m_cost[bucket][engine].sampleCount < MCPY_COST_MIN_SAMPLES)
+        {
+            continue;
+        }
+
+        uint64_t cost = m_cost[bucket][engine].avgLatencyUs * (m_pendingCount[engine] + 1);
+        if (cost < bestCost)
+        {
+            bestCost   = cost;
+            mcpyEngine = (MCPY_ENGINE)engine;
+        }
+    }
+
+    return mcpyEngine != staticEngine;
+}
+
+bool MediaCopyCostModel::GetTimestampTarget(MCPY_ENGINE mcpyEngine, PMOS_RESOURCE &resource, uint32_t &startOffset, uint32_t &endOffset)
+{
+    if (m_timestamps == nullptr ||
+        (mcpyEngine != MCPY_ENGINE_VEBOX && mcpyEngine != MCPY_ENGINE_BLT) ||
+        m_pendingCount[mcpyEngine] == MCPY_COST_MAX_PENDING)
+    {
+        return false;
+    }
+
+    // The slot of the next pending copy, RecordSubmit appends it to the same position.
+    uint32_t index = (m_pendingHead[mcpyEngine] + m_pendingCount[mcpyEngine]) % MCPY_COST_MAX_PENDING;
+    uint32_t slot  = (uint32_t)mcpyEngine * MCPY_COST_MAX_PENDING + index;
+
+    resource    = &m_timestampBuffer;
+    startOffset = slot * sizeof(CopyTimestamp);
+    endOffset   = startOffset + sizeof(uint64_t);
+    return true;
+}
+
+void MediaCopyCostModel::RecordSubmit(MCPY_ENGINE mcpyEngine, uint32_t bucket)
+{
+    if (m_osInterface == nullptr || m_timestamps == nullptr ||
+        (uint32_t)mcpyEngine >= MCPY_COST_ENGINE_NUM || bucket >= MCPY_COST_BUCKET_NUM)
+    {
+        return;
+    }
+
+    MOS_GPU_CONTEXT gpuContext = m_osInterface->pfnGetGpuContext(m_osInterface);
+    if (gpuContext >= MOS_GPU_CONTEXT_MAX)
+    {
+        return;
+    }
+
+    // The status tag is bumped once per tracked submission; an unchanged tag means the
+    // copy did not go through frame tracking on this interface and cannot be timed.
+    uint32_t tag = m_osInterface->pfnGetGpuStatusTag(m_osInterface, gpuContext) - 1;
+    if (gpuContext == m_lastContext[mcpyEngine] && tag == m_lastTag[mcpyEngine])
+    {
+        return;
+    }
+    m_lastContext[mcpyEngine] = gpuContext;
+    m_lastTag[mcpyEngine]     = tag;
+
+    // GetTimestampTarget refuses timing while the ring is full.
+    if (m_pendingCount[mcpyEngine] == MCPY_COST_MAX_PENDING)
+    {
+        return;
+    }
+
+    uint32_t     index   = (m_pendingHead[mcpyEngine] + m_pendingCount[mcpyEngine]) % MCPY_COST_MAX_PENDING;
+    PendingCopy &pending = m_pending[mcpyEngine][index];
+
+    pending.bucket     = bucket;
+    pending.gpuContext = gpuContext;
+    pending.tag        = tag;
+
+    m_pendingCount[mcpyEngine]++;
+}
@@ -0,0 +1,172 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     media_copy_cost_model.h
+//! \brief    Measured per-engine cost model used by media copy engine selection
+//! \details  Tracks the GPU execution time of copies submitted on each engine,
+//!           bucketed by copy size, tiling and compression, and picks the engine
+//!           with the lowest expected completion time for a new copy.
+//!
+
+#ifndef __MEDIA_COPY_COST_MODEL_H__
+#define __MEDIA_COPY_COST_MODEL_H__
+
+#include "media_copy.h"
+
+#define MCPY_COST_SIZE_CLASS_NUM     5    // <256KB, <1MB, <4MB, <16MB, >=16MB
+#define MCPY_COST_BUCKET_NUM         (MCPY_COST_SIZE_CLASS_NUM * 4)
+#define MCPY_COST_ENGINE_NUM         3    // vebox, blt, render; render copies are not timed
+#define MCPY_COST_MAX_PENDING        16   // in-flight copies tracked per engine
+#define MCPY_COST_MIN_SAMPLES        2    // samples needed before an engine cost is trusted
+#define MCPY_COST_EXPLORE_PERIOD     32   // copies per bucket between re-probing a stale engine
+#define MCPY_COST_EWMA_SHIFT         3    // moving average weight of 1/8 for new samples
+
+class MediaCopyCostModel
+{
+public:
+    //!
+    //! \brief    MediaCopyCostModel constructor
+    //! \param    osInterface
+    //!           [in] Pointer to MOS_INTERFACE shared with the copy engines.
+    //!
+    MediaCopyCostModel(PMOS_INTERFACE osInterface);
+
+    virtual ~MediaCopyCostModel();
+
+    //!
+    //! \brief    Initialize cost model
+    //! \details  Allocate and map the buffer the copy engines write their GPU
+    //!           timestamps to.
+    //! \return   MOS_STATUS
+    //!           Return MOS_STATUS_SUCCESS if successful, otherwise failed
+    //!
+    MOS_STATUS Initialize();
+
+    //!
+    //! \brief    Get cost bucket of a copy.
+    //! \param    size
+    //!           [in] copy size in bytes
+    //! \param    tiled
+    //!           [in] source or destination is tiled
+    //! \param    compressed
+    //!           [in] source or destination is compressed
+    //! \return   uint32_t
+    //!           bucket index in [0, MCPY_COST_BUCKET_NUM)
+    //!
+    static uint32_t GetBucket(uint64_t size, bool tiled, bool compressed);
+
+    //!
+    //! \brief    Retire completed copies.
+    //! \details  Polls the GPU status sync tag of every engine with copies in flight
+    //!           and folds the GPU time between the start and end timestamps of
+    //!           each completed copy into its bucket.
+    //! \return   void
+    //!
+    void Update();
+
+    //!
+    //! \brief    Select the engine with the lowest expected completion time.
+    //! \details  Expected completion time is the measured average latency of the
+    //!           bucket scaled by the copies still in flight on that engine. Timed
+    //!           engines without enough samples are probed periodically, otherwise
+    //!           the caller's static choice is kept.
+    //! \param    bucket
+    //!           [in] cost bucket of the copy
+    //! \param    caps
+    //!           [in] engines allowed for this copy
+    //! \param    mcpyEngine
+    //!           [in/out] static choice on input, selected engine on output
+    //! \return   bool
+    //!           true if the selection differs from the static choice.
+    //!
+    bool SelectEngine(uint32_t bucket, const MCPY_ENGINE_CAPS &caps, MCPY_ENGINE &mcpyEngine);
+
+    //!
+    //! \brief    Get where the next copy on an engine writes its timestamps.
+    //! \details  The copy must write the GPU timestamp to startOffset before its
+    //!           commands and to endOffset after them, then be passed to RecordSubmit.
+    //! \param    mcpyEngine
+    //!           [in] engine the copy will be submitted on
+    //! \param    resource
+    //!           [out] timestamp buffer
+    //! \param    startOffset
+    //!           [out] offset of the start timestamp
+    //! \param    endOffset
+    //!           [out] offset of the end timestamp
+    //! \return   bool
+    //!           false if the copy cannot be timed, it must not be recorded then.
+    //!
+    bool GetTimestampTarget(MCPY_ENGINE mcpyEngine, PMOS_RESOURCE &resource, uint32_t &startOffset, uint32_t &endOffset);
+
+    //!
+    //! \brief    Record a copy just submitted on an engine.
+    //! \details  Must be called right after the engine copy returns so that the
+    //!           current GPU context and its status tag belong to that copy, and
+    //!           only for copies which wrote the timestamps of GetTimestampTarget.
+    //! \param    mcpyEngine
+    //!           [in] engine the copy was submitted on
+    //! \param    bucket
+    //!           [in] cost bucket of the copy
+    //! \return   void
+    //!
+    void RecordSubmit(MCPY_ENGINE mcpyEngine, uint32_t bucket);
+
+protected:
+    struct PendingCopy
+    {
+        uint32_t        bucket;
+        MOS_GPU_CONTEXT gpuContext;
+        uint32_t        tag;
+    };
+
+    // One slot per pending copy, written by the GPU.
+    struct CopyTimestamp
+    {
+        uint64_t start;
+        uint64_t end;
+    };
+
+    struct EngineCost
+    {
+        uint64_t avgLatencyUs;
+        uint32_t sampleCount;
+    };
+
+    uint64_t GetTimeUs(uint64_t ticks);
+    void     AddSample(uint32_t engine, uint32_t bucket, uint64_t latencyUs);
+
+    PMOS_INTERFACE           m_osInterface     = nullptr;
+    uint64_t                 m_frequency       = 0;        // GPU timestamp frequency
+    MOS_RESOURCE             m_timestampBuffer = {};
+    volatile CopyTimestamp  *m_timestamps      = nullptr;  // mapped m_timestampBuffer, null if not initialized
+
+    EngineCost      m_cost[MCPY_COST_BUCKET_NUM][MCPY_COST_ENGINE_NUM]          = {};
+    uint32_t        m_copyCount[MCPY_COST_BUCKET_NUM]                          = {};
+    PendingCopy     m_pending[MCPY_COST_ENGINE_NUM][MCPY_COST_MAX_PENDING]     = {};
+    uint32_t        m_pendingHead[MCPY_COST_ENGINE_NUM]                        = {};
+    uint32_t        m_pendingCount[MCPY_COST_ENGINE_NUM]                       = {};
+    MOS_GPU_CONTEXT m_lastContext[MCPY_COST_ENGINE_NUM]                        = {};
+    uint32_t        m_lastTag[MCPY_COST_ENGINE_NUM]                            = {};
+
+MEDIA_CLASS_DEFINE_END(MediaCopyCostModel)
+};
+#endif  // __MEDIA_COPY_COST_MODEL_H__
@@ -174,6 +174,7 @@ MOS_STATUS VeboxCopyStateNext::CopyMainSurface(PMOS_RESOURCE src, PMOS_RESOURCE
     MediaPerfProfiler* perfProfiler = MediaPerfProfiler::Instance();
     VEBOX_COPY_CHK_NULL_RETURN(perfProfiler);
     VEBOX_COPY_CHK_STATUS_RETURN(perfProfiler->AddPerfCollectStartCmd((void*)this, m_osInterface, m_miItf, &cmdBuffer));
+    VEBOX_COPY_CHK_STATUS_RETURN(AddTimestampCmd(&cmdBuffer, m_timestampStartOffset));
 
     // Set Vebox MMIO
     VEBOX_COPY_CHK_STATUS_RETURN(m_miItf->AddVeboxMMIOPrologCmd(&cmdBuffer));
@@ -198,6 +199,7 @@ MOS_STATUS VeboxCopyStateNext::CopyMainSurface(PMOS_RESOURCE src, PMOS_RESOURCE
     auto& flushDwParams = m_miItf->MHW_GETPAR_F(MI_FLUSH_DW)();
     flushDwParams = {};
     VEBOX_COPY_CHK_STATUS_RETURN(m_miItf->MHW_ADDCMD_F(MI_FLUSH_DW)(&cmdBuffer));
+    VEBOX_COPY_CHK_STATUS_RETURN(AddTimestampCmd(&cmdBuffer, m_timestampEndOffset));
 
     if (!m_osInterface->bEnableKmdMediaFrameTracking && veboxHeap)
     {
@@ -469,6 +471,26 @@ MOS_STATUS VeboxCopyStateNext::SetupVeboxSurfaceState(
     return eStatus;
 }
 
+MOS_STATUS VeboxCopyStateNext::AddTimestampCmd(PMOS_COMMAND_BUFFER cmdBuffer, uint32_t offset)
+{
+    if (m_timestampResource == nullptr)
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+    VEBOX_COPY_CHK_NULL_RETURN(cmdBuffer);
+    VEBOX_COPY_CHK_NULL_RETURN(m_miItf);
+
+    auto& flushDwParams             = m_miItf->MHW_GETPAR_F(MI_FLUSH_DW)();
+    flushDwParams                   = {};
+    flushDwParams.pOsResource       = m_timestampResource;
+    flushDwParams.dwResourceOffset  = offset;
+    flushDwParams.postSyncOperation = MHW_FLUSH_WRITE_TIMESTAMP_REG;
+    flushDwParams.bQWordEnable      = 1;
+    VEBOX_COPY_CHK_STATUS_RETURN(m_miItf->MHW_ADDCMD_F(MI_FLUSH_DW)(cmdBuffer));
+
+    return MOS_STATUS_SUCCESS;
+}
+
 MOS_STATUS VeboxCopyStateNext::InitCommandBuffer(PMOS_COMMAND_BUFFER cmdBuffer)
 {
     PMOS_INTERFACE              pOsInterface;
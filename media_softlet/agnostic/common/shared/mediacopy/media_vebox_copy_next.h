@@ -88,6 +88,25 @@ public:
         PMOS_RESOURCE src,
         PMOS_RESOURCE dst);
 
+    //!
+    //! \brief    Set copy timestamp target
+    //! \details  Following copies write the GPU timestamp before and after their
+    //!           commands to the given resource, null resource stops it.
+    //! \param    resource
+    //!           [in] Pointer to timestamp buffer
+    //! \param    startOffset
+    //!           [in] offset of start timestamp, qword aligned
+    //! \param    endOffset
+    //!           [in] offset of end timestamp, qword aligned
+    //! \return   void
+    //!
+    void SetTimestampTarget(PMOS_RESOURCE resource, uint32_t startOffset, uint32_t endOffset)
+    {
+        m_timestampResource    = resource;
+        m_timestampStartOffset = startOffset;
+        m_timestampEndOffset   = endOffset;
+    }
+
     //!
     //! Is ve copy supported surface
     //! \param    [in/out]     surface
@@ -132,6 +151,18 @@ protected:
     MOS_STATUS InitCommandBuffer(
         PMOS_COMMAND_BUFFER              cmdBuffer);
 
+    //!
+    //! \brief    Add timestamp command
+    //! \details  Write the GPU timestamp to the timestamp target, nothing if no target is set.
+    //! \param    cmdBuffer
+    //!           [in] Pointer to command buffer
+    //! \param    offset
+    //!           [in] offset in timestamp target
+    //! \return   MOS_STATUS
+    //!           Return MOS_STATUS_SUCCESS if successful, otherwise failed
+    //!
+    MOS_STATUS AddTimestampCmd(PMOS_COMMAND_BUFFER cmdBuffer, uint32_t offset);
+
     //!
     //! Is ve copy supported format
     //! \param    [in/out] surface mos format
@@ -151,6 +182,10 @@ protected:
     std::shared_ptr<mhw::mi::Itf>    m_miItf    = nullptr;
     std::shared_ptr<mhw::vebox::Itf> m_veboxItf = nullptr;
 
+    PMOS_RESOURCE                    m_timestampResource    = nullptr;
+    uint32_t                         m_timestampStartOffset = 0;
+    uint32_t                         m_timestampEndOffset   = 0;
+
     MEDIA_CLASS_DEFINE_END(VeboxCopyStateNext)
 };
 
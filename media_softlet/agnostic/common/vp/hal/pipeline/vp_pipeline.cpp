@@ -548,7 +548,9 @@ MOS_STATUS VpPipeline::ExecuteSingleswFilterPipe(VpSinglePipeContext *singlePipe
 
     bool isPacketPipeReused = false;
     VP_PUBLIC_CHK_NULL_RETURN(m_pvpParams.renderParams);
-    VP_PUBLIC_CHK_STATUS_RETURN(chkStatusHandler(packetReuseMgr->PreparePacketPipeReuse(pipe, *policy, *resourceManager, isPacketPipeReused, m_pvpParams.renderParams->bOptimizeCpuTiming)));
+    // renderParams shares storage with sfcParams, only legacy params carry the cpu timing hint.
+    bool isTeamsWL = (PIPELINE_PARAM_TYPE_LEGACY == m_pvpParams.type) ? m_pvpParams.renderParams->bOptimizeCpuTiming : false;
+    VP_PUBLIC_CHK_STATUS_RETURN(chkStatusHandler(packetReuseMgr->PreparePacketPipeReuse(pipe, *policy, *resourceManager, isPacketPipeReused, isTeamsWL)));
 
     if (isPacketPipeReused)
     {
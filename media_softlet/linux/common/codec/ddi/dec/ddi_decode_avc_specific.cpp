@@ -373,8 +373,8 @@ VAStatus DdiDecodeAvc::AllocSliceParamContext(
     if (m_sliceParamBufNum < (m_decodeCtx->DecodeParams.m_numSlices + numSlices))
     {
         // in order to avoid that the buffer is reallocated multi-times,
-        // extra 10 slices are added.
-        uint32_t extraSlices                       = numSlices + 10;
+        // it grows geometrically.
+        uint32_t extraSlices                       = GetSliceArrayGrowNum(m_sliceParamBufNum, m_decodeCtx->DecodeParams.m_numSlices + numSlices) - m_sliceParamBufNum;
         m_decodeCtx->DecodeParams.m_sliceParams = realloc(m_decodeCtx->DecodeParams.m_sliceParams,
             baseSize * (m_sliceParamBufNum + extraSlices));
 
@@ -560,6 +560,7 @@ VAStatus DdiDecodeAvc::AllocSliceControlBuffer(
     DDI_CODEC_COM_BUFFER_MGR *bufMgr   = nullptr;
     uint32_t                 availSize = 0;
     uint32_t                 newSize   = 0;
+    uint32_t                 newNum    = 0;
 
     bufMgr    = &(m_decodeCtx->BufMgr);
     availSize = m_sliceCtrlBufNum - bufMgr->dwNumSliceControl;
@@ -568,14 +569,15 @@ VAStatus DdiDecodeAvc::AllocSliceControlBuffer(
     {
         if (availSize < buf->uiNumElements)
         {
-            newSize = sizeof(VASliceParameterBufferBase) * (m_sliceCtrlBufNum - availSize + buf->uiNumElements);
+            newNum  = GetSliceArrayGrowNum(m_sliceCtrlBufNum, bufMgr->dwNumSliceControl + buf->uiNumElements);
+            newSize = sizeof(VASliceParameterBufferBase) * newNum;
             bufMgr->Codec_Param.Codec_Param_H264.pVASliceParaBufH264Base = (VASliceParameterBufferBase *)realloc(bufMgr->Codec_Param.Codec_Param_H264.pVASliceParaBufH264Base, newSize);
             if (bufMgr->Codec_Param.Codec_Param_H264.pVASliceParaBufH264Base == nullptr)
             {
                 return VA_STATUS_ERROR_ALLOCATION_FAILED;
             }
-            MOS_ZeroMemory(bufMgr->Codec_Param.Codec_Param_H264.pVASliceParaBufH264Base + m_sliceCtrlBufNum, sizeof(VASliceParameterBufferBase) * (buf->uiNumElements - availSize));
-            m_sliceCtrlBufNum = m_sliceCtrlBufNum - availSize + buf->uiNumElements;
+            MOS_ZeroMemory(bufMgr->Codec_Param.Codec_Param_H264.pVASliceParaBufH264Base + m_sliceCtrlBufNum, sizeof(VASliceParameterBufferBase) * (newNum - m_sliceCtrlBufNum));
+            m_sliceCtrlBufNum = newNum;
         }
         buf->pData    = (uint8_t*)bufMgr->Codec_Param.Codec_Param_H264.pVASliceParaBufH264Base;
         buf->uiOffset = bufMgr->dwNumSliceControl * sizeof(VASliceParameterBufferBase);
@@ -584,14 +586,15 @@ VAStatus DdiDecodeAvc::AllocSliceControlBuffer(
     {
         if (availSize < buf->uiNumElements)
         {
-            newSize = sizeof(VASliceParameterBufferH264) * (m_sliceCtrlBufNum - availSize + buf->uiNumElements);
+            newNum  = GetSliceArrayGrowNum(m_sliceCtrlBufNum, bufMgr->dwNumSliceControl + buf->uiNumElements);
+            newSize = sizeof(VASliceParameterBufferH264) * newNum;
             bufMgr->Codec_Param.Codec_Param_H264.pVASliceParaBufH264 = (VASliceParameterBufferH264 *)realloc(bufMgr->Codec_Param.Codec_Param_H264.pVASliceParaBufH264, newSize);
             if (bufMgr->Codec_Param.Codec_Param_H264.pVASliceParaBufH264 == nullptr)
             {
                 return VA_STATUS_ERROR_ALLOCATION_FAILED;
             }
-            MOS_ZeroMemory(bufMgr->Codec_Param.Codec_Param_H264.pVASliceParaBufH264 + m_sliceCtrlBufNum, sizeof(VASliceParameterBufferH264) * (buf->uiNumElements - availSize));
-            m_sliceCtrlBufNum = m_sliceCtrlBufNum - availSize + buf->uiNumElements;
+            MOS_ZeroMemory(bufMgr->Codec_Param.Codec_Param_H264.pVASliceParaBufH264 + m_sliceCtrlBufNum, sizeof(VASliceParameterBufferH264) * (newNum - m_sliceCtrlBufNum));
+            m_sliceCtrlBufNum = newNum;
          }
          buf->pData    = (uint8_t*)bufMgr->Codec_Param.Codec_Param_H264.pVASliceParaBufH264;
          buf->uiOffset = bufMgr->dwNumSliceControl * sizeof(VASliceParameterBufferH264);
@@ -551,10 +551,10 @@ VAStatus DdiDecodeBase::AllocBsBuffer(
     if (index >= bufMgr->m_maxNumSliceData)
     {
         /* In theroy it can resize the m_maxNumSliceData one by one. But in order to
-         * avoid calling realloc frequently, it will try to allocate 10 to  hold more
-         * SliceDataBuf. This is only for the optimized purpose.
+         * avoid calling realloc frequently, it grows the array geometrically to hold
+         * more SliceDataBuf. This is only for the optimized purpose.
          */
-        int32_t reallocSize = bufMgr->m_maxNumSliceData + 10;
+        uint32_t reallocSize = GetSliceArrayGrowNum(bufMgr->m_maxNumSliceData, index + 1);
 
         bufMgr->pSliceData  = (DDI_CODEC_BITSTREAM_BUFFER_INFO *)realloc(bufMgr->pSliceData, sizeof(bufMgr->pSliceData[0]) * reallocSize);
 
@@ -564,9 +564,9 @@ VAStatus DdiDecodeBase::AllocBsBuffer(
             return VA_STATUS_ERROR_ALLOCATION_FAILED;
         }
         memset(bufMgr->pSliceData + bufMgr->m_maxNumSliceData, 0,
-               sizeof(bufMgr->pSliceData[0]) * 10);
+               sizeof(bufMgr->pSliceData[0]) * (reallocSize - bufMgr->m_maxNumSliceData));
 
-        bufMgr->m_maxNumSliceData += 10;
+        bufMgr->m_maxNumSliceData = reallocSize;
     }
 
     if (index >= 1)
@@ -943,6 +943,12 @@ VAStatus DdiDecodeBase::InitDummyReference(DecodePipelineAdapter &decoder)
     return VA_STATUS_SUCCESS;
 }
 
+uint32_t DdiDecodeBase::GetSliceArrayGrowNum(uint32_t curNum, uint32_t requiredNum)
+{
+    // keep some headroom for small arrays, double the big ones
+    return MOS_MAX(requiredNum + 10, curNum * 2);
+}
+
 VAStatus DdiDecodeBase::EndPicture(
     VADriverContextP ctx,
     VAContextID      context)
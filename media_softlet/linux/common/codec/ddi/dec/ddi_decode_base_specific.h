@@ -455,6 +455,20 @@ protected:
     //!           VA_STATUS_SUCCESS if success, else fail reason
     VAStatus InitDummyReference(DecodePipelineAdapter& decoder);
 
+    //! \brief    Get new size of a slice level array
+    //! \details  Slice level arrays only grow, and they grow geometrically, so that a frame
+    //!           with thousands of slices sent in separate buffers reallocates them a few
+    //!           times instead of once per buffer.
+    //!
+    //! \param    [in] curNum
+    //!           Current number of elements
+    //! \param    [in] requiredNum
+    //!           Number of elements required
+    //!
+    //! \return   uint32_t
+    //!           New number of elements, not less than requiredNum
+    static uint32_t GetSliceArrayGrowNum(uint32_t curNum, uint32_t requiredNum);
+
     //! \brief  the type of decode base class
     MOS_SURFACE           m_destSurface;          //!<Destination Surface structure
     uint32_t              m_groupIndex;           //!<global Group
@@ -1065,25 +1065,37 @@ VAStatus DdiDecodeFunctions::StatusReport(
                     (tempNewReport.codecStatus == CODECHAL_STATUS_RESET)        ||
                     (tempNewReport.codecStatus == CODECHAL_STATUS_INCOMPLETE))
                 {
-                    PDDI_MEDIA_SURFACE_HEAP_ELEMENT mediaSurfaceHeapElmt = (PDDI_MEDIA_SURFACE_HEAP_ELEMENT)mediaCtx->pSurfaceHeap->pHeapBase;
+                    DDI_MEDIA_SURFACE *reportSurface = nullptr;
 
-                    uint32_t j = 0;
-                    for (j = 0; j < mediaCtx->pSurfaceHeap->uiAllocatedHeapElements && mediaSurfaceHeapElmt != nullptr; j++, mediaSurfaceHeapElmt++)
+                    // Reports retire in decode order, so when the application syncs each output before
+                    // handing it on (e.g. to an encoder), the report belongs to the synced surface and
+                    // the walk over the whole surface heap can be skipped.
+                    if (bo == surface->bo)
                     {
-                        if (mediaSurfaceHeapElmt->pSurface != nullptr && bo == mediaSurfaceHeapElmt->pSurface->bo)
+                        reportSurface = surface;
+                    }
+                    else
+                    {
+                        PDDI_MEDIA_SURFACE_HEAP_ELEMENT mediaSurfaceHeapElmt = (PDDI_MEDIA_SURFACE_HEAP_ELEMENT)mediaCtx->pSurfaceHeap->pHeapBase;
+                        for (uint32_t j = 0; j < mediaCtx->pSurfaceHeap->uiAllocatedHeapElements && mediaSurfaceHeapElmt != nullptr; j++, mediaSurfaceHeapElmt++)
                         {
-                            mediaSurfaceHeapElmt->pSurface->curStatusReport.decode.status = (uint32_t)tempNewReport.codecStatus;
-                            mediaSurfaceHeapElmt->pSurface->curStatusReport.decode.errMbNum = (uint32_t)tempNewReport.numMbsAffected;
-                            mediaSurfaceHeapElmt->pSurface->curStatusReport.decode.crcValue = (uint32_t)tempNewReport.frameCrc;
-                            mediaSurfaceHeapElmt->pSurface->curStatusReportQueryState = DDI_MEDIA_STATUS_REPORT_QUERY_STATE_COMPLETED;
-                            break;
+                            if (mediaSurfaceHeapElmt->pSurface != nullptr && bo == mediaSurfaceHeapElmt->pSurface->bo)
+                            {
+                                reportSurface = mediaSurfaceHeapElmt->pSurface;
+                                break;
+                            }
                         }
                     }
 
-                    if (j == mediaCtx->pSurfaceHeap->uiAllocatedHeapElements)
+                    if (reportSurface == nullptr)
                     {
                         return VA_STATUS_ERROR_OPERATION_FAILED;
                     }
+
+                    reportSurface->curStatusReport.decode.status   = (uint32_t)tempNewReport.codecStatus;
+                    reportSurface->curStatusReport.decode.errMbNum = (uint32_t)tempNewReport.numMbsAffected;
+                    reportSurface->curStatusReport.decode.crcValue = (uint32_t)tempNewReport.frameCrc;
+                    reportSurface->curStatusReportQueryState       = DDI_MEDIA_STATUS_REPORT_QUERY_STATE_COMPLETED;
                 }
                 else
                 {
@@ -852,8 +852,8 @@ VAStatus DdiDecodeHevc::AllocSliceParamContext(uint32_t numSlices)
     if (m_sliceParamBufNum < (m_decodeCtx->DecodeParams.m_numSlices + numSlices))
     {
         // in order to avoid that the buffer is reallocated multi-times,
-        // extra 10 slices are added.
-        uint32_t extraSlices = numSlices + 10;
+        // it grows geometrically.
+        uint32_t extraSlices = GetSliceArrayGrowNum(m_sliceParamBufNum, m_decodeCtx->DecodeParams.m_numSlices + numSlices) - m_sliceParamBufNum;
 
         m_decodeCtx->DecodeParams.m_sliceParams = realloc(m_decodeCtx->DecodeParams.m_sliceParams,
             baseSize * (m_sliceParamBufNum + extraSlices));
@@ -1085,6 +1085,7 @@ VAStatus DdiDecodeHevc::AllocSliceControlBuffer(DDI_MEDIA_BUFFER *buf)
     DDI_CODEC_COM_BUFFER_MGR *bufMgr   = nullptr;
     uint32_t                 availSize = 0;
     uint32_t                 newSize   = 0;
+    uint32_t                 newNum    = 0;
 
     bufMgr    = &(m_decodeCtx->BufMgr);
     availSize = m_sliceCtrlBufNum - bufMgr->dwNumSliceControl;
@@ -1099,14 +1100,15 @@ VAStatus DdiDecodeHevc::AllocSliceControlBuffer(DDI_MEDIA_BUFFER *buf)
             if (buf->iSize / buf->uiNumElements != sizeof(VASliceParameterBufferBase))
                 return VA_STATUS_ERROR_ALLOCATION_FAILED;
 
-            newSize = sizeof(VASliceParameterBufferBase) * (m_sliceCtrlBufNum - availSize + buf->uiNumElements);
+            newNum  = GetSliceArrayGrowNum(m_sliceCtrlBufNum, bufMgr->dwNumSliceControl + buf->uiNumElements);
+            newSize = sizeof(VASliceParameterBufferBase) * newNum;
             bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufBaseHEVC = (VASliceParameterBufferBase *)realloc(bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufBaseHEVC, newSize);
             if (bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufBaseHEVC == nullptr)
             {
                 return VA_STATUS_ERROR_ALLOCATION_FAILED;
             }
-            MOS_ZeroMemory(bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufBaseHEVC + m_sliceCtrlBufNum, sizeof(VASliceParameterBufferBase) * (buf->uiNumElements - availSize));
-            m_sliceCtrlBufNum = m_sliceCtrlBufNum - availSize + buf->uiNumElements;
+            MOS_ZeroMemory(bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufBaseHEVC + m_sliceCtrlBufNum, sizeof(VASliceParameterBufferBase) * (newNum - m_sliceCtrlBufNum));
+            m_sliceCtrlBufNum = newNum;
         }
         buf->pData    = (uint8_t*)bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufBaseHEVC;
         buf->uiOffset = bufMgr->dwNumSliceControl * sizeof(VASliceParameterBufferBase);
@@ -1120,14 +1122,15 @@ VAStatus DdiDecodeHevc::AllocSliceControlBuffer(DDI_MEDIA_BUFFER *buf)
                 if (buf->iSize / buf->uiNumElements != sizeof(VASliceParameterBufferHEVC))
                     return VA_STATUS_ERROR_ALLOCATION_FAILED;
 
-                newSize = sizeof(VASliceParameterBufferHEVC) * (m_sliceCtrlBufNum - availSize + buf->uiNumElements);
+                newNum  = GetSliceArrayGrowNum(m_sliceCtrlBufNum, bufMgr->dwNumSliceControl + buf->uiNumElements);
+                newSize = sizeof(VASliceParameterBufferHEVC) * newNum;
                 bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufHEVC = (VASliceParameterBufferHEVC *)realloc(bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufHEVC, newSize);
                 if (bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufHEVC == nullptr)
                 {
                     return VA_STATUS_ERROR_ALLOCATION_FAILED;
                 }
-                MOS_ZeroMemory(bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufHEVC + m_sliceCtrlBufNum, sizeof(VASliceParameterBufferHEVC) * (buf->uiNumElements - availSize));
-                m_sliceCtrlBufNum = m_sliceCtrlBufNum - availSize + buf->uiNumElements;
+                MOS_ZeroMemory(bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufHEVC + m_sliceCtrlBufNum, sizeof(VASliceParameterBufferHEVC) * (newNum - m_sliceCtrlBufNum));
+                m_sliceCtrlBufNum = newNum;
             }
             buf->pData    = (uint8_t*)bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufHEVC;
             buf->uiOffset = bufMgr->dwNumSliceControl * sizeof(VASliceParameterBufferHEVC);
@@ -1139,14 +1142,15 @@ VAStatus DdiDecodeHevc::AllocSliceControlBuffer(DDI_MEDIA_BUFFER *buf)
                 if (buf->iSize / buf->uiNumElements != sizeof(VASliceParameterBufferHEVCExtension))
                     return VA_STATUS_ERROR_ALLOCATION_FAILED;
 
-                newSize = sizeof(VASliceParameterBufferHEVCExtension) * (m_sliceCtrlBufNum - availSize + buf->uiNumElements);
+                newNum  = GetSliceArrayGrowNum(m_sliceCtrlBufNum, bufMgr->dwNumSliceControl + buf->uiNumElements);
+                newSize = sizeof(VASliceParameterBufferHEVCExtension) * newNum;
                 bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufHEVCRext= (VASliceParameterBufferHEVCExtension*)realloc(bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufHEVCRext, newSize);
                 if (bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufHEVCRext == nullptr)
                 {
                     return VA_STATUS_ERROR_ALLOCATION_FAILED;
                 }
-                MOS_ZeroMemory(bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufHEVCRext+ m_sliceCtrlBufNum, sizeof(VASliceParameterBufferHEVCExtension) * (buf->uiNumElements - availSize));
-                m_sliceCtrlBufNum = m_sliceCtrlBufNum - availSize + buf->uiNumElements;
+                MOS_ZeroMemory(bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufHEVCRext+ m_sliceCtrlBufNum, sizeof(VASliceParameterBufferHEVCExtension) * (newNum - m_sliceCtrlBufNum));
+                m_sliceCtrlBufNum = newNum;
             }
             buf->pData    = (uint8_t*)bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufHEVCRext;
             buf->uiOffset = bufMgr->dwNumSliceControl * sizeof(VASliceParameterBufferHEVCExtension);
@@ -727,8 +727,8 @@ VAStatus DdiDecodeJpeg::AllocSliceParamContext(
     if (m_sliceParamBufNum < (m_decodeCtx->DecodeParams.m_numSlices + numSlices))
     {
         // in order to avoid that the buffer is reallocated multi-times,
-        // extra 10 slices are added.
-        uint32_t extraSlices = numSlices + 10;
+        // it grows geometrically.
+        uint32_t extraSlices = GetSliceArrayGrowNum(m_sliceParamBufNum, m_decodeCtx->DecodeParams.m_numSlices + numSlices) - m_sliceParamBufNum;
 
         m_decodeCtx->DecodeParams.m_sliceParams = realloc(m_decodeCtx->DecodeParams.m_sliceParams,
             baseSize * (m_sliceParamBufNum + extraSlices));
@@ -435,8 +435,8 @@ VAStatus DdiDecodeMpeg2::AllocSliceParamContext(
     if (m_sliceParamBufNum < (m_decodeCtx->DecodeParams.m_numSlices + numSlices))
     {
         // in order to avoid that the buffer is reallocated multi-times,
-        // extra 10 slices are added.
-        uint32_t extraSlices = numSlices + 10;
+        // it grows geometrically.
+        uint32_t extraSlices = GetSliceArrayGrowNum(m_sliceParamBufNum, m_decodeCtx->DecodeParams.m_numSlices + numSlices) - m_sliceParamBufNum;
 
         m_decodeCtx->DecodeParams.m_sliceParams = realloc(m_decodeCtx->DecodeParams.m_sliceParams,
             baseSize * (m_sliceParamBufNum + extraSlices));
@@ -481,19 +481,21 @@ VAStatus DdiDecodeMpeg2::AllocSliceControlBuffer(
     DDI_CODEC_COM_BUFFER_MGR *bufMgr   = nullptr;
     uint32_t                 availSize = 0;
     uint32_t                 newSize   = 0;
+    uint32_t                 newNum    = 0;
 
     bufMgr     = &(m_decodeCtx->BufMgr);
     availSize  = m_sliceCtrlBufNum - bufMgr->dwNumSliceControl;
     if(availSize < buf->uiNumElements)
     {
-        newSize = sizeof(VASliceParameterBufferMPEG2) * (m_sliceCtrlBufNum - availSize + buf->uiNumElements);
+        newNum  = GetSliceArrayGrowNum(m_sliceCtrlBufNum, bufMgr->dwNumSliceControl + buf->uiNumElements);
+        newSize = sizeof(VASliceParameterBufferMPEG2) * newNum;
         bufMgr->Codec_Param.Codec_Param_MPEG2.pVASliceParaBufMPEG2 = (VASliceParameterBufferMPEG2 *)realloc(bufMgr->Codec_Param.Codec_Param_MPEG2.pVASliceParaBufMPEG2, newSize);
         if (bufMgr->Codec_Param.Codec_Param_MPEG2.pVASliceParaBufMPEG2 == nullptr)
         {
             return VA_STATUS_ERROR_ALLOCATION_FAILED;
         }
-        MOS_ZeroMemory(bufMgr->Codec_Param.Codec_Param_MPEG2.pVASliceParaBufMPEG2 + m_sliceCtrlBufNum, sizeof(VASliceParameterBufferMPEG2) * (buf->uiNumElements - availSize));
-        m_sliceCtrlBufNum = m_sliceCtrlBufNum - availSize + buf->uiNumElements;
+        MOS_ZeroMemory(bufMgr->Codec_Param.Codec_Param_MPEG2.pVASliceParaBufMPEG2 + m_sliceCtrlBufNum, sizeof(VASliceParameterBufferMPEG2) * (newNum - m_sliceCtrlBufNum));
+        m_sliceCtrlBufNum = newNum;
     }
     buf->pData    = (uint8_t*)bufMgr->Codec_Param.Codec_Param_MPEG2.pVASliceParaBufMPEG2;
     buf->uiOffset = sizeof(VASliceParameterBufferMPEG2) * bufMgr->dwNumSliceControl;